@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include "ecs/Snapshot.hpp"
 #include <string>
 #include <chrono>
 
@@ -125,3 +126,17 @@ struct PlayerInfo {
 };
 
 }
+
+// Composants capturés par Registry::save_snapshot (PlayerCell et PlayerInfo
+// portent un std::string et n'y participent pas)
+ECS_SNAPSHOT_COMPONENT(bagario::components::Mass);
+ECS_SNAPSHOT_COMPONENT(bagario::components::Food);
+ECS_SNAPSHOT_COMPONENT(bagario::components::Virus);
+ECS_SNAPSHOT_COMPONENT(bagario::components::EjectedMass);
+ECS_SNAPSHOT_COMPONENT(bagario::components::CellOwner);
+ECS_SNAPSHOT_COMPONENT(bagario::components::MovementTarget);
+ECS_SNAPSHOT_COMPONENT(bagario::components::MergeTimer);
+ECS_SNAPSHOT_COMPONENT(bagario::components::SplitVelocity);
+ECS_SNAPSHOT_COMPONENT(bagario::components::CircleCollider);
+ECS_SNAPSHOT_COMPONENT(bagario::components::NetworkId);
+ECS_SNAPSHOT_COMPONENT(bagario::components::Score);
@@ -16,28 +16,23 @@ void BagarioCollisionSystem::update(Registry& registry, float dt) {
     auto& masses = registry.get_components<components::Mass>();
     auto& colliders = registry.get_components<components::CircleCollider>();
     auto& foods = registry.get_components<components::Food>();
-    auto& player_cells = registry.get_components<components::PlayerCell>();
-    auto& owners = registry.get_components<components::CellOwner>();
     auto& ejected_masses = registry.get_components<components::EjectedMass>();
     auto& viruses = registry.get_components<components::Virus>();
-    std::vector<size_t> cells;
-    std::vector<size_t> food_entities;
-    std::vector<size_t> ejected_entities;
-    std::vector<size_t> virus_entities;
+    // Entity lists maintained by the registry as components are added/removed
+    // (built on first call) instead of re-partitioning every Position each tick
+    const auto& food_entities = registry.observer<Position, components::CircleCollider, components::Food>()
+        .entities();
+    const auto& ejected_entities = registry.observer<Position, components::CircleCollider, components::EjectedMass>(
+        ecs::exclude<components::Food>).entities();
+    const auto& virus_entities = registry.observer<Position, components::CircleCollider, components::Virus>(
+        ecs::exclude<components::Food, components::EjectedMass>).entities();
+    const auto& player_cells = registry.observer<Position, components::CircleCollider, components::PlayerCell>(
+        ecs::exclude<components::Food, components::EjectedMass, components::Virus>).entities();
+    const auto& owned_cells = registry.observer<Position, components::CircleCollider, components::CellOwner>(
+        ecs::exclude<components::Food, components::EjectedMass, components::Virus, components::PlayerCell>).entities();
+    std::vector<size_t> cells(player_cells.begin(), player_cells.end());
 
-    for (size_t i = 0; i < positions.size(); ++i) {
-        Entity entity = positions.get_entity_at(i);
-        if (!colliders.has_entity(entity))
-            continue;
-        if (foods.has_entity(entity))
-            food_entities.push_back(entity);
-        else if (ejected_masses.has_entity(entity))
-            ejected_entities.push_back(entity);
-        else if (viruses.has_entity(entity))
-            virus_entities.push_back(entity);
-        else if (player_cells.has_entity(entity) || owners.has_entity(entity))
-            cells.push_back(entity);
-    }
+    cells.insert(cells.end(), owned_cells.begin(), owned_cells.end());
     for (size_t cell : cells) {
         if (!masses.has_entity(cell))
             continue;
@@ -11,6 +11,7 @@
 
 #include "plugin_manager/INetworkPlugin.hpp"
 #include "plugin_manager/PluginManager.hpp"
+#include "core/TickScheduler.hpp"
 
 #include "BagarioConfig.hpp"
 #include "PacketTypes.hpp"
@@ -132,7 +133,8 @@ private:
     // Timing
     std::chrono::steady_clock::time_point m_last_snapshot_time;
     std::chrono::steady_clock::time_point m_last_leaderboard_time;
-    std::chrono::steady_clock::time_point m_last_tick_time;
+    // run() waits here for its tick: fixed 1/TICK_RATE step on absolute deadlines
+    core::TickScheduler m_tick_scheduler{config::TICK_RATE};
 
     // Random number generation for colors
     std::mt19937 m_rng{std::random_device{}()};
@@ -114,6 +114,11 @@ public:
      */
     size_t get_player_cell_count(uint32_t player_id) const;
 
+    /**
+     * @brief Access the session registry (e.g. Registry::save_snapshot checkpoints)
+     */
+    Registry& get_registry() { return m_registry; }
+
 private:
     void register_components();
     void setup_systems();
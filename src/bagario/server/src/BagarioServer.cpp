@@ -5,7 +5,6 @@
 #include "plugin_manager/PluginPaths.hpp"
 
 #include <iostream>
-#include <thread>
 #include <chrono>
 
 namespace bagario::server {
@@ -96,7 +95,7 @@ bool BagarioServer::start() {
     auto now = std::chrono::steady_clock::now();
     m_last_snapshot_time = now;
     m_last_leaderboard_time = now;
-    m_last_tick_time = now;
+    m_tick_scheduler.reset();
     m_running = true;
     std::cout << "[BagarioServer] Server started successfully" << std::endl;
     return true;
@@ -107,6 +106,9 @@ void BagarioServer::stop() {
         return;
     std::cout << "[BagarioServer] Stopping server..." << std::endl;
     m_running = false;
+    core::TickStats stats = m_tick_scheduler.stats();
+    std::cout << "[BagarioServer] " << stats.ticks << " ticks (" << stats.overruns << " overruns, "
+              << stats.late_starts << " late starts, " << stats.dropped << " dropped)" << std::endl;
 
     if (m_session)
         m_session->shutdown();
@@ -121,13 +123,15 @@ void BagarioServer::stop() {
 void BagarioServer::run() {
     if (!m_running)
     return;
+    // Pas fixe : en retard, la session rattrape les ticks manqués (4 au plus)
+    uint32_t steps = m_tick_scheduler.wait();
+    float dt = m_tick_scheduler.step_seconds();
     auto now = std::chrono::steady_clock::now();
-    float dt = std::chrono::duration<float>(now - m_last_tick_time).count();
-    m_last_tick_time = now;
 
-    m_network->update(dt);
+    m_network->update(dt * static_cast<float>(steps));
     m_network_handler->process_packets();
-    m_session->update(dt);
+    for (uint32_t i = 0; i < steps; i++)
+        m_session->update(dt);
     auto snapshot_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
         now - m_last_snapshot_time
     ).count();
@@ -142,10 +146,6 @@ void BagarioServer::run() {
         broadcast_leaderboard();
         m_last_leaderboard_time = now;
     }
-    auto tick_duration = std::chrono::steady_clock::now() - now;
-    auto target_duration = std::chrono::milliseconds(config::TICK_INTERVAL_MS);
-    if (tick_duration < target_duration)
-        std::this_thread::sleep_for(target_duration - tick_duration);
 }
 
 size_t BagarioServer::get_player_count() const {
@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** TickScheduler
+*/
+
+#ifndef TICKSCHEDULER_HPP_
+#define TICKSCHEDULER_HPP_
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace core {
+
+/**
+ * @brief What wait() does with the ticks whose deadline has already passed
+ *
+ * CatchUp: run them back to back (at most max_catch_up per wait), so the
+ * simulation keeps wall-clock time; the excess is dropped.
+ * Drop: run a single tick and skip the others, the simulation falls behind
+ * wall-clock time instead of bursting.
+ */
+enum class CatchUpPolicy {
+    CatchUp,
+    Drop
+};
+
+/**
+ * @brief Counters of a TickScheduler since its last reset()
+ */
+struct TickStats {
+    uint64_t ticks = 0;         // Pas de simulation rendus par wait()
+    uint64_t overruns = 0;      // Ticks dont le travail a dépassé un pas
+    uint64_t late_starts = 0;   // Réveils après l'échéance + tolérance
+    uint64_t dropped = 0;       // Pas sautés par la politique de rattrapage
+};
+
+/**
+ * @brief Fixed-timestep loop pacing on absolute steady_clock deadlines
+ *
+ * Deadlines sit on a fixed grid (start + k * step, step computed in
+ * nanoseconds from the tick rate): a late wake-up never shifts the next
+ * one, so the rate does not drift. wait() sleeps until shortly before the
+ * deadline, then spins (yielding) for the last spin margin, which absorbs
+ * the OS sleep granularity.
+ *
+ * @code
+ * core::TickScheduler scheduler(64);
+ * while (running) {
+ *     uint32_t steps = scheduler.wait();
+ *     for (uint32_t i = 0; i < steps; i++)
+ *         update(scheduler.step_seconds());
+ * }
+ * @endcode
+ *
+ * wait() and reset() belong to the loop thread; stats() may be read from
+ * any thread.
+ */
+class TickScheduler {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        explicit TickScheduler(uint32_t tick_rate, CatchUpPolicy policy = CatchUpPolicy::CatchUp,
+            uint32_t max_catch_up = 4);
+
+        /**
+         * @brief Block until the next deadline and return the number of steps to run (>= 1)
+         *
+         * The first call after construction or reset() returns at once and
+         * anchors the deadline grid.
+         */
+        uint32_t wait();
+
+        // Oublie la grille d'échéances et remet les compteurs à zéro
+        void reset();
+
+        TickStats stats() const;
+
+        Clock::duration step() const { return step_; }
+        float step_seconds() const { return std::chrono::duration<float>(step_).count(); }
+        uint32_t tick_rate() const { return tick_rate_; }
+
+        // Temps d'attente active avant l'échéance (1 ms par défaut)
+        void set_spin_margin(Clock::duration margin) { spin_margin_ = margin; }
+
+    private:
+        uint32_t tick_rate_;
+        Clock::duration step_;
+        CatchUpPolicy policy_;
+        uint32_t max_catch_up_;
+        Clock::duration spin_margin_;
+        // Réveil au-delà de ce retard : late start (un huitième de pas)
+        Clock::duration late_threshold_;
+
+        bool started_ = false;
+        Clock::time_point next_deadline_;
+        Clock::time_point tick_start_;
+
+        std::atomic<uint64_t> ticks_{0};
+        std::atomic<uint64_t> overruns_{0};
+        std::atomic<uint64_t> late_starts_{0};
+        std::atomic<uint64_t> dropped_{0};
+};
+
+}
+
+#endif /* !TICKSCHEDULER_HPP_ */
@@ -1,29 +1,174 @@
 #pragma once
 
 #include "Event.hpp"
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <memory>
-#include <queue>
-#include <typeindex>
-#include <unordered_map>
+#include <optional>
+#include <utility>
 #include <vector>
-#include <any>
 
 namespace core {
 
+/**
+ * @brief Dense per-type event identifier (0, 1, 2... in order of first use)
+ *
+ * Same scheme as ecs::ComponentFamily: the EventBus indexes its channel
+ * vector with it, without RTTI or hashing.
+ */
+class EventFamily {
+    public:
+        template<typename EventType>
+        static size_t id() {
+            static const size_t value = next();
+            return value;
+        }
+
+    private:
+        static size_t next() {
+            static std::atomic<size_t> counter{0};
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
+};
+
+/**
+ * @brief FIFO queue over a power-of-two circular array
+ *
+ * Slots are reused once the queue has grown to its working size, so pushing
+ * and popping in steady state does not allocate.
+ */
+template<typename T>
+class RingBuffer {
+    public:
+        void push(const T& value) {
+            if (count_ == slots_.size())
+                grow();
+            slots_[(head_ + count_) & (slots_.size() - 1)].emplace(value);
+            count_++;
+        }
+
+        // Retire et retourne l'élément le plus ancien (la file ne doit pas être vide)
+        T pop() {
+            std::optional<T>& slot = slots_[head_];
+            T value = std::move(*slot);
+
+            slot.reset();
+            head_ = (head_ + 1) & (slots_.size() - 1);
+            count_--;
+            return value;
+        }
+
+        size_t size() const {
+            return count_;
+        }
+
+        bool empty() const {
+            return count_ == 0;
+        }
+
+    private:
+        std::vector<std::optional<T>> slots_;
+        size_t head_ = 0;
+        size_t count_ = 0;
+
+        void grow() {
+            std::vector<std::optional<T>> larger(slots_.empty() ? 16 : slots_.size() * 2);
+
+            for (size_t i = 0; i < count_; ++i)
+                larger[i] = std::move(slots_[(head_ + i) & (slots_.size() - 1)]);
+            slots_ = std::move(larger);
+            head_ = 0;
+        }
+};
+
+/**
+ * @brief Unbounded lock-free multi-producer / single-consumer intrusive queue
+ *
+ * Any thread may push(); only the owning thread may pop(). Pushing is one
+ * atomic exchange and one store, so producers never wait on each other or on
+ * the consumer. Nodes are owned by the caller: the queue only links them
+ * through their `next` member (Node derives from MpscHook<Node>).
+ *
+ * pop() returns nullptr when the queue is empty, and also when a producer is
+ * between its exchange and its store: that node is then returned by a later
+ * pop(), order is preserved.
+ */
+template<typename Node>
+struct MpscHook {
+    std::atomic<Node*> next{nullptr};
+};
+
+template<typename Node>
+class MpscQueue {
+    public:
+        MpscQueue() : head_(&stub_), tail_(&stub_) {}
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        void push(Node* node) {
+            node->next.store(nullptr, std::memory_order_relaxed);
+            Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        Node* pop() {
+            Node* tail = tail_;
+            Node* next = tail->next.load(std::memory_order_acquire);
+
+            if (tail == &stub_) {
+                if (!next)
+                    return nullptr;
+                tail_ = next;
+                tail = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+            if (next) {
+                tail_ = next;
+                return tail;
+            }
+            // Dernier nœud : on ne le rend qu'une fois le stub relié derrière lui
+            if (tail != head_.load(std::memory_order_acquire))
+                return nullptr;
+            push(&stub_);
+            next = tail->next.load(std::memory_order_acquire);
+            if (!next)
+                return nullptr;
+            tail_ = next;
+            return tail;
+        }
+
+    private:
+        Node stub_;
+        std::atomic<Node*> head_;
+        Node* tail_;
+};
+
 /**
  * @brief Generic event bus implementation using publish/subscribe pattern
  *
  * The EventBus provides a decoupled communication mechanism between systems.
  * Systems can publish events without knowing who consumes them, and subscribe
  * to events they're interested in without knowing the publisher.
+ *
+ * Each event type has its own typed channel: a contiguous array of
+ * subscribers called directly with the event (no std::any), and a ring
+ * buffer of deferred events delivered in batches by process_deferred().
+ * Once the subscriber arrays and ring buffers have reached their working
+ * size, publishing does not allocate.
+ *
+ * The bus belongs to one thread (its session). publish_concurrent() is the
+ * only method other threads may call: it hands the event over through a
+ * lock-free queue, and the owning thread delivers it in process_deferred().
  */
 class EventBus {
     public:
         using SubscriptionId = size_t;
 
         EventBus();
-        ~EventBus() = default;
+        ~EventBus();
+        EventBus(const EventBus&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
 
         /**
          * @brief Subscribe to an event type with a callback function
@@ -43,8 +188,20 @@ class EventBus {
         template<typename EventType>
         void publish_deferred(const EventType& event);
 
+        /**
+         * @brief Queue an event for deferred processing from any thread
+         *
+         * Lock-free (one allocation for the event, then one atomic exchange).
+         * Events from one producer thread are delivered in their publish order.
+         */
+        template<typename EventType>
+        void publish_concurrent(const EventType& event);
+
         /**
          * @brief Process all deferred events in the queue
+         *
+         * Events published with publish_concurrent() before the call are
+         * delivered first, in the order the queue hands them over.
          */
         void process_deferred();
 
@@ -70,41 +227,200 @@ class EventBus {
         size_t getDeferredEventCount() const;
 
     private:
-        using Callback = std::function<void(const std::any&)>;
-        using Subscription = std::pair<SubscriptionId, Callback>;
-        using DeferredPublisher = std::function<void()>;
+        /**
+         * @brief Type-erased view of a channel, for the operations that span all event types
+         */
+        class IChannel {
+            public:
+                virtual ~IChannel() = default;
+
+                // Présent dans pendingChannels_ (des événements différés attendent)
+                bool queued = false;
 
-        SubscriptionId subscribeImpl(std::type_index typeIndex, Callback callback);
-        void publishImpl(std::type_index typeIndex, const std::any& event);
-        void publishDeferredImpl(std::type_index typeIndex, const std::any& event);
-        size_t getSubscriberCountImpl(std::type_index typeIndex) const;
+                virtual bool unsubscribe(SubscriptionId subscriptionId) = 0;
+                // Délivre les événements différés en attente, retourne leur nombre
+                virtual size_t deliver() = 0;
+        };
+
+        template<typename EventType>
+        class Channel : public IChannel {
+            public:
+                struct Subscriber {
+                    SubscriptionId id;
+                    std::function<void(const EventType&)> callback;
+                    bool active;
+                };
+
+                RingBuffer<EventType> pending;
+                size_t activeCount = 0;
+
+                void add(SubscriptionId id, std::function<void(const EventType&)> callback) {
+                    // Pendant un envoi, le tableau parcouru ne doit pas être réalloué :
+                    // le nouvel abonné le rejoint à la fin de l'envoi
+                    if (dispatching_ > 0)
+                        incoming_.push_back({id, std::move(callback), true});
+                    else
+                        subscribers_.push_back({id, std::move(callback), true});
+                    activeCount++;
+                }
+
+                void publish(const EventType& event) {
+                    dispatching_++;
+                    for (Subscriber& subscriber : subscribers_)
+                        if (subscriber.active)
+                            subscriber.callback(event);
+                    dispatching_--;
+                    if (dispatching_ == 0)
+                        settle();
+                }
+
+                bool unsubscribe(SubscriptionId subscriptionId) override {
+                    if (!deactivate(subscribers_, subscriptionId) && !deactivate(incoming_, subscriptionId))
+                        return false;
+                    activeCount--;
+                    if (dispatching_ == 0)
+                        settle();
+                    return true;
+                }
+
+                size_t deliver() override {
+                    // Seuls les événements déjà en file forment ce lot ; ceux publiés
+                    // pendant la livraison attendent le lot suivant
+                    size_t batch = pending.size();
+
+                    for (size_t i = 0; i < batch; ++i)
+                        publish(pending.pop());
+                    return batch;
+                }
+
+            private:
+                std::vector<Subscriber> subscribers_;
+                std::vector<Subscriber> incoming_;
+                size_t dispatching_ = 0;
+
+                // Un désabonnement pendant un envoi ne fait que désactiver l'abonné
+                static bool deactivate(std::vector<Subscriber>& list, SubscriptionId subscriptionId) {
+                    for (Subscriber& subscriber : list) {
+                        if (subscriber.id == subscriptionId && subscriber.active) {
+                            subscriber.active = false;
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                // Hors envoi : retire les abonnés désactivés et intègre les nouveaux
+                void settle() {
+                    if (!incoming_.empty() || activeCount != subscribers_.size()) {
+                        std::erase_if(subscribers_, [](const Subscriber& subscriber) { return !subscriber.active; });
+                        for (Subscriber& subscriber : incoming_)
+                            if (subscriber.active)
+                                subscribers_.push_back(std::move(subscriber));
+                        incoming_.clear();
+                    }
+                }
+        };
+
+        /**
+         * @brief Event handed over by publish_concurrent(), waiting in concurrent_
+         */
+        struct ConcurrentEvent : MpscHook<ConcurrentEvent> {
+            virtual ~ConcurrentEvent() = default;
+            // Appelé par le thread propriétaire : délivre l'événement aux abonnés
+            virtual void forward(EventBus&) {}
+        };
+
+        template<typename EventType>
+        struct TypedConcurrentEvent : ConcurrentEvent {
+            EventType event;
+
+            explicit TypedConcurrentEvent(const EventType& value) : event(value) {}
+            void forward(EventBus& bus) override {
+                bus.publish(event);
+            }
+        };
 
-        std::unordered_map<std::type_index, std::vector<Subscription>> subscribers_;
-        std::queue<DeferredPublisher> deferredEvents_;
+        // Délivre les événements concurrents reçus jusqu'ici (thread propriétaire)
+        void drain_concurrent();
+
+        template<typename EventType>
+        Channel<EventType>& channel();
+
+        template<typename EventType>
+        const Channel<EventType>* findChannel() const;
+
+        // Indexé par EventFamily::id<EventType>(), nullptr si le type n'a jamais servi
+        std::vector<std::unique_ptr<IChannel>> channels_;
+        // Canaux ayant des événements différés, dans l'ordre de leur premier événement
+        // (livrés par lots : FIFO par type d'événement)
+        std::vector<IChannel*> pendingChannels_;
+        std::vector<IChannel*> deliveringChannels_;
+        size_t deferredCount_;
         SubscriptionId nextSubscriptionId_;
+        MpscQueue<ConcurrentEvent> concurrent_;
+        std::atomic<size_t> concurrentCount_;
     };
 
+    template<typename EventType>
+    EventBus::Channel<EventType>& EventBus::channel() {
+        size_t family = EventFamily::id<EventType>();
+
+        if (family >= channels_.size())
+            channels_.resize(family + 1);
+        if (!channels_[family])
+            channels_[family] = std::make_unique<Channel<EventType>>();
+        return *static_cast<Channel<EventType>*>(channels_[family].get());
+    }
+
+    template<typename EventType>
+    const EventBus::Channel<EventType>* EventBus::findChannel() const {
+        size_t family = EventFamily::id<EventType>();
+
+        if (family >= channels_.size())
+            return nullptr;
+        return static_cast<const Channel<EventType>*>(channels_[family].get());
+    }
+
     template<typename EventType>
     EventBus::SubscriptionId EventBus::subscribe(std::function<void(const EventType&)> callback) {
-        auto wrapper = [callback](const std::any& event) {
-            callback(std::any_cast<const EventType&>(event));
-        };
-        return subscribeImpl(typeid(EventType), wrapper);
+        Channel<EventType>& target = channel<EventType>();
+        SubscriptionId id = nextSubscriptionId_++;
+
+        target.add(id, std::move(callback));
+        return id;
     }
 
     template<typename EventType>
     void EventBus::publish(const EventType& event) {
-        publishImpl(typeid(EventType), event);
+        size_t family = EventFamily::id<EventType>();
+
+        if (family < channels_.size() && channels_[family])
+            static_cast<Channel<EventType>*>(channels_[family].get())->publish(event);
     }
 
     template<typename EventType>
     void EventBus::publish_deferred(const EventType& event) {
-        publishDeferredImpl(typeid(EventType), event);
+        Channel<EventType>& target = channel<EventType>();
+
+        if (!target.queued) {
+            target.queued = true;
+            pendingChannels_.push_back(&target);
+        }
+        target.pending.push(event);
+        deferredCount_++;
+    }
+
+    template<typename EventType>
+    void EventBus::publish_concurrent(const EventType& event) {
+        concurrentCount_.fetch_add(1, std::memory_order_relaxed);
+        concurrent_.push(new TypedConcurrentEvent<EventType>(event));
     }
 
     template<typename EventType>
     size_t EventBus::getSubscriberCount() const {
-        return getSubscriberCountImpl(typeid(EventType));
+        const Channel<EventType>* target = findChannel<EventType>();
+
+        return target ? target->activeCount : 0;
     }
 
 }
@@ -0,0 +1,253 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** Archetype
+*/
+
+#ifndef ARCHETYPE_HPP_
+#define ARCHETYPE_HPP_
+#include "ComponentPool.hpp"
+#include "ComponentMask.hpp"
+#include "Group.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @brief Component storage layout of a Registry (Registry::set_storage_backend)
+ *
+ * SparseSet (default): each pool keeps its entities in insertion order,
+ * views probe the other pools through the sparse index.
+ * Archetype: entities are also bucketed by exact signature, and each pool
+ * is kept sorted by archetype, so a view walks whole archetypes with every
+ * component at a known dense position (one compare instead of a sparse
+ * lookup per component).
+ */
+enum class StorageBackend {
+    SparseSet,
+    Archetype
+};
+
+/**
+ * @brief Entities sharing exactly the same set of components
+ */
+struct Archetype {
+    ComponentMask mask;
+    std::vector<Entity> entities;
+};
+
+/**
+ * @brief Archetype table of a Registry in StorageBackend::Archetype mode
+ *
+ * The component data stays in the existing dense pools, so SparseSet access
+ * (get_components, find, groups) keeps working unchanged. What changes is
+ * their order: after compact(), the entities of each archetype form one
+ * contiguous segment of every pool they own, in the archetype's row order.
+ * A view then visits archetype by archetype, row r being at offset(family,
+ * archetype) + r in each pool.
+ *
+ * Structural changes only update the table (swap-remove then append, O(1))
+ * and mark the entity's pools dirty; pools are re-sorted lazily, by the
+ * next view over them. A pool owned by a group keeps the group members
+ * first (archetypes containing every owned component), in the same order
+ * in all owned pools, so the group invariant holds.
+ *
+ * Archetypes are looked up by a linear scan of their masks: game worlds
+ * have a few dozen of them at most.
+ */
+class ArchetypeIndex {
+    public:
+        static constexpr uint32_t NONE = UINT32_MAX;
+
+        explicit ArchetypeIndex(const std::vector<std::unique_ptr<IComponentPool>>& pools) : pools_(pools) {}
+
+        // Déplace l'entité après un changement de signature (before -> after)
+        void move(Entity entity, const ComponentMask& before, const ComponentMask& after)
+        {
+            uint32_t slot = ecs::entity::index(entity);
+
+            if (slot >= locations_.size())
+                locations_.resize(slot + 1);
+            Location& location = locations_[slot];
+
+            if (location.archetype != NONE)
+                detach(location);
+            if (!after.none()) {
+                location.archetype = find_or_create(after);
+                location.row = static_cast<uint32_t>(archetypes_[location.archetype].entities.size());
+                archetypes_[location.archetype].entities.push_back(entity);
+            }
+            dirty_ |= before;
+            dirty_ |= after;
+        }
+
+        /**
+         * @brief Recompute the whole table from the pools and signatures (slot-indexed)
+         */
+        void rebuild(const std::vector<ComponentMask>& signatures)
+        {
+            archetypes_.clear();
+            locations_.assign(signatures.size(), Location{});
+            for (const auto& pool : pools_) {
+                if (!pool)
+                    continue;
+                for (Entity entity : pool->entities()) {
+                    uint32_t slot = ecs::entity::index(entity);
+
+                    if (slot < signatures.size() && locations_[slot].archetype == NONE)
+                        move(entity, {}, signatures[slot]);
+                }
+            }
+            for (size_t family = 0; family < pools_.size() && family < MAX_COMPONENTS; family++)
+                dirty_.set(family);
+        }
+
+        void mark_dirty(const ComponentMask& families)
+        {
+            dirty_ |= families;
+        }
+
+        /**
+         * @brief Leave the order of a pool to its user (Registry::sort)
+         *
+         * compact() no longer moves it; views read it through the sparse index.
+         */
+        void pin(size_t family)
+        {
+            pinned_.set(family);
+            if (family < offsets_.size())
+                offsets_[family].clear();
+        }
+
+        /**
+         * @brief Sort the dirty pools among families by archetype
+         *
+         * The other pools of a group are sorted along, to stay aligned.
+         */
+        void compact(const ComponentMask& families)
+        {
+            ComponentMask todo;
+
+            families.for_each([&](size_t family) {
+                if (!dirty_.test(family) || pinned_.test(family) || family >= pools_.size() || !pools_[family])
+                    return;
+                todo.set(family);
+                if (pools_[family]->group)
+                    todo |= pools_[family]->group->owned();
+            });
+            todo.for_each([this](size_t family) {
+                if (family < pools_.size() && pools_[family])
+                    sort_pool(family);
+                dirty_.reset(family);
+            });
+        }
+
+        // Position de la première entité de l'archétype dans le pool, NONE si inconnue
+        uint32_t offset(size_t family, uint32_t archetype) const
+        {
+            if (family >= offsets_.size() || archetype >= offsets_[family].size())
+                return NONE;
+            return offsets_[family][archetype];
+        }
+
+        /**
+         * @brief Calls func(archetype id, row count) for each non-empty archetype
+         * owning all of include and none of exclude
+         */
+        template <typename Func>
+        void for_each_match(const ComponentMask& include, const ComponentMask& exclude, Func&& func) const
+        {
+            for (uint32_t id = 0; id < archetypes_.size(); id++) {
+                const Archetype& archetype = archetypes_[id];
+
+                if (!archetype.entities.empty() && archetype.mask.contains(include)
+                    && !archetype.mask.intersects(exclude))
+                    func(id, archetype.entities.size());
+            }
+        }
+
+        const Archetype& archetype(uint32_t id) const
+        {
+            return archetypes_[id];
+        }
+
+        size_t archetype_count() const
+        {
+            return archetypes_.size();
+        }
+
+    private:
+        struct Location {
+            uint32_t archetype = NONE;
+            uint32_t row = 0;
+        };
+
+        const std::vector<std::unique_ptr<IComponentPool>>& pools_;
+        std::vector<Archetype> archetypes_;
+        // Indexé par slot d'entité
+        std::vector<Location> locations_;
+        // offsets_[family][archetype] : début du segment de l'archétype dans le pool
+        std::vector<std::vector<uint32_t>> offsets_;
+        ComponentMask dirty_;
+        ComponentMask pinned_;
+        // Tampons réutilisés par sort_pool
+        std::vector<uint32_t> ids_;
+        std::vector<Entity> order_;
+
+        uint32_t find_or_create(const ComponentMask& mask)
+        {
+            for (uint32_t id = 0; id < archetypes_.size(); id++)
+                if (archetypes_[id].mask == mask)
+                    return id;
+            archetypes_.push_back({mask, {}});
+            return static_cast<uint32_t>(archetypes_.size() - 1);
+        }
+
+        // Retrait par échange avec la dernière ligne de l'archétype
+        void detach(Location& location)
+        {
+            std::vector<Entity>& entities = archetypes_[location.archetype].entities;
+            Entity last = entities.back();
+
+            entities[location.row] = last;
+            locations_[ecs::entity::index(last)].row = location.row;
+            entities.pop_back();
+            location.archetype = NONE;
+        }
+
+        void sort_pool(size_t family)
+        {
+            IComponentPool* pool = pools_[family].get();
+            ComponentMask lead;
+
+            if (pool->group)
+                lead = pool->group->owned();
+            ids_.clear();
+            for (uint32_t id = 0; id < archetypes_.size(); id++)
+                if (archetypes_[id].mask.test(family))
+                    ids_.push_back(id);
+            // Membres du groupe en tête : mêmes archétypes, même ordre dans chaque pool possédé
+            std::stable_partition(ids_.begin(), ids_.end(), [&](uint32_t id) {
+                return archetypes_[id].mask.contains(lead);
+            });
+
+            if (family >= offsets_.size())
+                offsets_.resize(family + 1);
+            offsets_[family].assign(archetypes_.size(), NONE);
+            order_.clear();
+            for (uint32_t id : ids_) {
+                offsets_[family][id] = static_cast<uint32_t>(order_.size());
+                order_.insert(order_.end(), archetypes_[id].entities.begin(), archetypes_[id].entities.end());
+            }
+            pool->arrange(order_);
+        }
+};
+
+}
+
+#endif /* !ARCHETYPE_HPP_ */
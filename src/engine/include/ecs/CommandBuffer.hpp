@@ -0,0 +1,192 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** CommandBuffer
+*/
+
+#ifndef COMMANDBUFFER_HPP_
+#define COMMANDBUFFER_HPP_
+#include "ComponentPool.hpp"
+#include "Prefab.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class Registry;
+
+namespace ecs {
+
+/**
+ * @brief Type-erased storage of the components recorded for one component type
+ */
+class ICommandQueue {
+    public:
+        virtual ~ICommandQueue() = default;
+
+        // Réserve la place dans le pool pour tous les composants en attente
+        virtual void reserve(Registry& registry) = 0;
+        virtual void add(Registry& registry, Entity entity, uint32_t payload) = 0;
+        virtual void remove(Registry& registry, Entity entity) = 0;
+        virtual void clear() = 0;
+};
+
+template <typename Component>
+class CommandQueue : public ICommandQueue {
+    public:
+        std::vector<Component> values;
+
+        void reserve(Registry& registry) override;
+        void add(Registry& registry, Entity entity, uint32_t payload) override;
+        void remove(Registry& registry, Entity entity) override;
+
+        void clear() override
+        {
+            values.clear();
+        }
+};
+
+/**
+ * @brief Records structural changes (spawn, add, remove, kill) to apply later
+ *
+ * Systems record into a buffer while iterating, and the changes are applied
+ * in recording order by flush(), at a sync point where no view or group is
+ * being walked (Registry::run_systems flushes the Registry buffer after each
+ * system). Recorded components are stored per type in contiguous vectors,
+ * and flush() spawns every pending entity and reserves every touched pool in
+ * one go, so a burst of projectiles costs a single allocation per pool.
+ *
+ * instantiate() records a whole prefab batch as one command: its entities
+ * are spawned with the other pending ones and stamped pool by pool at
+ * flush, where the initializer runs. The prefab must outlive the flush.
+ *
+ * spawn() returns a placeholder handle that is only meaningful to this
+ * buffer (it can be passed to add/remove/kill of the same buffer) until the
+ * buffer is flushed; it is resolved to a real entity during flush().
+ *
+ * A buffer is not thread-safe: use one per thread.
+ */
+class CommandBuffer {
+    public:
+        // Génération réservée aux handles provisoires retournés par spawn()
+        static constexpr uint32_t PENDING_GENERATION = UINT32_MAX;
+
+        Entity spawn()
+        {
+            return ecs::entity::make(pending_spawns_++, PENDING_GENERATION);
+        }
+
+        template <typename Component>
+        void add(Entity entity, Component&& component)
+        {
+            using ComponentType = std::decay_t<Component>;
+            CommandQueue<ComponentType>& queue = queue_of<ComponentType>();
+
+            commands_.push_back({Kind::Add, ComponentFamily::id<ComponentType>(), entity,
+                static_cast<uint32_t>(queue.values.size())});
+            queue.values.push_back(std::forward<Component>(component));
+        }
+
+        template <typename Component, typename... Args>
+        void emplace(Entity entity, Args&&... args)
+        {
+            if constexpr (std::is_constructible_v<Component, Args&&...>)
+                add(entity, Component(std::forward<Args>(args)...));
+            else
+                add(entity, Component{std::forward<Args>(args)...});
+        }
+
+        template <typename Component>
+        void remove(Entity entity)
+        {
+            queue_of<Component>();
+            commands_.push_back({Kind::Remove, ComponentFamily::id<Component>(), entity, 0});
+        }
+
+        void kill(Entity entity)
+        {
+            commands_.push_back({Kind::Kill, 0, entity, 0});
+        }
+
+        /**
+         * @brief Record count instances of a prefab, see Registry::instantiate
+         *
+         * init(index, entity, Components&...) is called at flush, with the
+         * real entity. Defined in Registry.hpp.
+         */
+        template <typename... Components, typename Init>
+        void instantiate(const Prefab& prefab, size_t count, Init&& init);
+
+        void instantiate(const Prefab& prefab, size_t count)
+        {
+            instantiate(prefab, count, [](size_t, Entity) {});
+        }
+
+        bool empty() const
+        {
+            return commands_.empty() && pending_spawns_ == 0;
+        }
+
+        /**
+         * @brief Apply every recorded command to the registry, then reset the buffer
+         *
+         * Defined in Registry.hpp.
+         */
+        void flush(Registry& registry);
+
+        static bool is_pending(Entity entity)
+        {
+            return ecs::entity::generation(entity) == PENDING_GENERATION;
+        }
+
+    private:
+        enum class Kind : uint8_t {
+            Add,
+            Remove,
+            Kill,
+            Instantiate
+        };
+
+        struct Command {
+            Kind kind;
+            size_t family;
+            Entity entity;
+            uint32_t payload;
+        };
+
+        // Lot de prefab en attente : entités [index du handle, + count) des créations
+        struct Batch {
+            const Prefab* prefab;
+            uint32_t count;
+            std::function<void(Registry&, const Prefab&, const Entity*, size_t)> stamp;
+        };
+
+        std::vector<Command> commands_;
+        std::vector<Batch> batches_;
+        std::vector<Entity> batch_entities_;
+        // Indexé par ecs::ComponentFamily::id<Component>(), comme les pools du Registry
+        std::vector<std::unique_ptr<ICommandQueue>> queues_;
+        uint32_t pending_spawns_ = 0;
+        std::vector<Entity> spawned_;
+
+        template <typename Component>
+        CommandQueue<Component>& queue_of()
+        {
+            size_t family = ComponentFamily::id<Component>();
+
+            if (family >= queues_.size())
+                queues_.resize(family + 1);
+            if (!queues_[family])
+                queues_[family] = std::make_unique<CommandQueue<Component>>();
+            return *static_cast<CommandQueue<Component>*>(queues_[family].get());
+        }
+
+        Entity resolve(Registry& registry, Entity entity);
+};
+
+}
+
+#endif /* !COMMANDBUFFER_HPP_ */
@@ -0,0 +1,102 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** ComponentMask
+*/
+
+#ifndef COMPONENTMASK_HPP_
+#define COMPONENTMASK_HPP_
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecs {
+
+// Nombre maximal de types de composants enregistrables (familles 0..127)
+inline constexpr size_t MAX_COMPONENTS = 128;
+
+/**
+ * @brief Fixed-size set of component family ids (one bit per component type)
+ *
+ * The Registry keeps one mask per entity slot (its "signature"), so it can
+ * visit only the pools an entity owns on destruction and answer "has all of"
+ * queries with a couple of word ANDs.
+ */
+class ComponentMask {
+    public:
+        void set(size_t family)
+        {
+            words_[family / 64] |= uint64_t{1} << (family % 64);
+        }
+
+        void reset(size_t family)
+        {
+            words_[family / 64] &= ~(uint64_t{1} << (family % 64));
+        }
+
+        void clear()
+        {
+            words_ = {};
+        }
+
+        bool test(size_t family) const
+        {
+            return (words_[family / 64] >> (family % 64)) & 1;
+        }
+
+        bool none() const
+        {
+            for (uint64_t word : words_)
+                if (word)
+                    return false;
+            return true;
+        }
+
+        // Vrai si tous les bits de other sont présents
+        bool contains(const ComponentMask& other) const
+        {
+            for (size_t i = 0; i < WORDS; i++)
+                if ((words_[i] & other.words_[i]) != other.words_[i])
+                    return false;
+            return true;
+        }
+
+        // Vrai si au moins un bit est commun
+        bool intersects(const ComponentMask& other) const
+        {
+            for (size_t i = 0; i < WORDS; i++)
+                if (words_[i] & other.words_[i])
+                    return true;
+            return false;
+        }
+
+        ComponentMask& operator|=(const ComponentMask& other)
+        {
+            for (size_t i = 0; i < WORDS; i++)
+                words_[i] |= other.words_[i];
+            return *this;
+        }
+
+        bool operator==(const ComponentMask& other) const = default;
+
+        // Appelle func(family) pour chaque bit présent, dans l'ordre croissant
+        template <typename Func>
+        void for_each(Func&& func) const
+        {
+            for (size_t i = 0; i < WORDS; i++) {
+                for (uint64_t bits = words_[i]; bits; bits &= bits - 1)
+                    func(i * 64 + static_cast<size_t>(std::countr_zero(bits)));
+            }
+        }
+
+    private:
+        static constexpr size_t WORDS = MAX_COMPONENTS / 64;
+
+        std::array<uint64_t, WORDS> words_{};
+};
+
+}
+
+#endif /* !COMPONENTMASK_HPP_ */
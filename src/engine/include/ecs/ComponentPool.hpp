@@ -0,0 +1,153 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** ComponentPool
+*/
+
+#ifndef COMPONENTPOOL_HPP_
+#define COMPONENTPOOL_HPP_
+#include "SparseSet.hpp"
+#include "Snapshot.hpp"
+#include "Signal.hpp"
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @brief Dense per-type component identifier
+ *
+ * Each component type gets a small integer the first time it is used
+ * (0, 1, 2...), stored in a function-local static so the lookup cost after
+ * that is a plain load. The Registry uses it to index its pool vector
+ * directly, without RTTI or hashing. The counter is atomic because sessions
+ * tick on worker threads and may touch a component type for the first time
+ * concurrently.
+ */
+class ComponentFamily {
+    public:
+        template <typename Component>
+        static size_t id()
+        {
+            static const size_t value = next();
+            return value;
+        }
+
+    private:
+        static size_t next()
+        {
+            static std::atomic<size_t> counter{0};
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
+};
+
+class IGroup;
+
+/**
+ * @brief Type-erased interface over a SparseSet, used for entity-wide operations
+ */
+class IComponentPool {
+    public:
+        virtual ~IComponentPool() = default;
+
+        // Groupe propriétaire du pool (au plus un), nullptr si le pool est libre
+        IGroup* group = nullptr;
+        // Émis par le Registry après l'ajout / avant le retrait d'un composant
+        Signal on_construct;
+        Signal on_destroy;
+
+        virtual void remove(Entity entity) = 0;
+        virtual bool contains(Entity entity) const = 0;
+        virtual const std::pmr::vector<Entity>& entities() const = 0;
+        // Réordonne le tableau dense (stockage par archétypes)
+        virtual void arrange(const std::vector<Entity>& order) = 0;
+
+        // Clé stable du type dans les snapshots, 0 si le composant n'y participe pas
+        virtual uint32_t snapshot_key() const = 0;
+        // Octets par entité d'un enregistrement (handle + composant)
+        virtual size_t snapshot_stride() const = 0;
+        virtual void save(std::vector<uint8_t>& out) = 0;
+        // Lit count entités déjà validées par le Registry
+        virtual void load(snapshot::Reader& in, size_t count) = 0;
+};
+
+template <typename Component>
+class ComponentPool : public IComponentPool {
+    public:
+        SparseSet<Component> set;
+
+        ComponentPool() = default;
+        explicit ComponentPool(std::pmr::memory_resource* resource) : set(resource) {}
+
+        void remove(Entity entity) override
+        {
+            set.erase(entity);
+        }
+
+        bool contains(Entity entity) const override
+        {
+            return set.has_entity(entity);
+        }
+
+        const std::pmr::vector<Entity>& entities() const override
+        {
+            return set.entities();
+        }
+
+        void arrange(const std::vector<Entity>& order) override
+        {
+            set.arrange(order);
+        }
+
+        uint32_t snapshot_key() const override
+        {
+            if constexpr (snapshot_traits<Component>::enabled)
+                return snapshot_traits<Component>::key;
+            else
+                return 0;
+        }
+
+        size_t snapshot_stride() const override
+        {
+            if constexpr (std::is_empty_v<Component>)
+                return sizeof(Entity);
+            else
+                return sizeof(Entity) + sizeof(Component);
+        }
+
+        void save(std::vector<uint8_t>& out) override
+        {
+            if constexpr (snapshot_traits<Component>::enabled) {
+                static_assert(std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>,
+                    "Snapshot components must be trivially copyable and default constructible");
+                const std::pmr::vector<Entity>& dense = set.entities();
+
+                snapshot::write<uint64_t>(out, dense.size());
+                snapshot::write_bytes(out, dense.data(), dense.size() * sizeof(Entity));
+                if constexpr (!std::is_empty_v<Component>)
+                    snapshot::write_bytes(out, set.raw(), dense.size() * sizeof(Component));
+            }
+        }
+
+        void load(snapshot::Reader& in, size_t count) override
+        {
+            if constexpr (snapshot_traits<Component>::enabled) {
+                const uint8_t* entities = in.take(count * sizeof(Entity));
+                const uint8_t* components = nullptr;
+
+                if constexpr (!std::is_empty_v<Component>)
+                    components = in.take(count * sizeof(Component));
+                set.assign_bytes(entities, components, count);
+            } else {
+                (void)in;
+                (void)count;
+            }
+        }
+};
+
+}
+
+#endif /* !COMPONENTPOOL_HPP_ */
@@ -8,6 +8,7 @@
 #ifndef CORE_COMPONENTS_HPP_
 #define CORE_COMPONENTS_HPP_
 
+#include "Snapshot.hpp"
 #include "plugin_manager/CommonTypes.hpp"
 #include "plugin_manager/IInputPlugin.hpp"
 #include <unordered_map>
@@ -169,4 +170,16 @@ struct FlashOverlay {
     float max_alpha = 200.0f;
 };
 
+// Composants capturés par Registry::save_snapshot (état de jeu, copiable octet par octet)
+ECS_SNAPSHOT_COMPONENT(Position);
+ECS_SNAPSHOT_COMPONENT(Velocity);
+ECS_SNAPSHOT_COMPONENT(Collider);
+ECS_SNAPSHOT_COMPONENT(Input);
+ECS_SNAPSHOT_COMPONENT(Sprite);
+ECS_SNAPSHOT_COMPONENT(Attached);
+ECS_SNAPSHOT_COMPONENT(Controllable);
+ECS_SNAPSHOT_COMPONENT(NoFriction);
+ECS_SNAPSHOT_COMPONENT(ToDestroy);
+ECS_SNAPSHOT_COMPONENT(CircleEffect);
+
 #endif /* !CORE_COMPONENTS_HPP_ */
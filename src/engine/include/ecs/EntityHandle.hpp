@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** EntityHandle
+*/
+
+#ifndef ENTITYHANDLE_HPP_
+#define ENTITYHANDLE_HPP_
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Generational entity handle
+ *
+ * The low 32 bits hold the slot index (used to address SparseSet pools),
+ * the high 32 bits hold the generation of that slot. When an entity is
+ * killed its index is recycled with a bumped generation, so any handle
+ * kept around to the old entity no longer matches and is detected as stale.
+ *
+ * Generation 0 handles are numerically equal to their index, which keeps
+ * freshly spawned entities numbered 0, 1, 2... as before.
+ */
+using Entity = size_t;
+
+namespace ecs::entity {
+
+constexpr unsigned INDEX_BITS = 32;
+constexpr Entity INDEX_MASK = (Entity{1} << INDEX_BITS) - 1;
+
+/**
+ * @brief Wire layout of an entity id (protocol fields are 32 bits)
+ *
+ * 20 bits of index (~1M live slots) and 12 bits of generation. The generation
+ * wraps on the wire, which is enough for clients to tell a recycled slot apart
+ * from the entity that previously used it.
+ */
+constexpr unsigned NETWORK_INDEX_BITS = 20;
+constexpr uint32_t NETWORK_INDEX_MASK = (uint32_t{1} << NETWORK_INDEX_BITS) - 1;
+constexpr uint32_t NETWORK_GENERATION_MASK = (uint32_t{1} << (32 - NETWORK_INDEX_BITS)) - 1;
+
+constexpr uint32_t index(Entity entity)
+{
+    return static_cast<uint32_t>(entity & INDEX_MASK);
+}
+
+constexpr uint32_t generation(Entity entity)
+{
+    return static_cast<uint32_t>(entity >> INDEX_BITS);
+}
+
+constexpr Entity make(uint32_t index, uint32_t generation)
+{
+    return (static_cast<Entity>(generation) << INDEX_BITS) | index;
+}
+
+/**
+ * @brief Convert a handle to the 32-bit id sent in protocol payloads
+ */
+constexpr uint32_t to_network_id(Entity entity)
+{
+    return ((generation(entity) & NETWORK_GENERATION_MASK) << NETWORK_INDEX_BITS)
+        | (index(entity) & NETWORK_INDEX_MASK);
+}
+
+}
+
+#endif /* !ENTITYHANDLE_HPP_ */
@@ -0,0 +1,151 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** Group
+*/
+
+#ifndef GROUP_HPP_
+#define GROUP_HPP_
+#include "ComponentPool.hpp"
+#include "ComponentMask.hpp"
+#include <tuple>
+#include <type_traits>
+
+namespace ecs {
+
+/**
+ * @brief Type-erased interface the Registry notifies on structural changes of owned pools
+ */
+class IGroup {
+    public:
+        virtual ~IGroup() = default;
+
+        // Appelé après l'ajout d'un composant possédé par le groupe
+        virtual void on_construct(Entity entity) = 0;
+        // Appelé avant le retrait d'un composant possédé par le groupe
+        virtual void on_destroy(Entity entity) = 0;
+        // Détache le groupe de ses pools (le groupe ne doit plus être utilisé)
+        virtual void release() = 0;
+        // Réaligne les pools après le remplacement complet de leur contenu
+        virtual void refresh() = 0;
+        // Familles des composants possédés
+        virtual ComponentMask owned() const = 0;
+};
+
+/**
+ * @brief Owning group: keeps the dense arrays of its pools sorted in lockstep
+ *
+ * Every entity owning all the Owned components sits at the same index
+ * [0, size()) of each owned SparseSet, so iterating the group is a linear
+ * sweep over parallel arrays, with no sparse lookup at all. Entities joining
+ * or leaving the group are swapped in or out of that prefix by the Registry
+ * (add_component, remove_component, kill_entity).
+ *
+ * A pool can be owned by a single group. Direct SparseSet::insert_at/erase
+ * calls on an owned pool bypass the group and must be avoided.
+ */
+template <typename... Owned>
+class Group : public IGroup {
+    static_assert(sizeof...(Owned) > 1, "A group needs at least two component types");
+
+    public:
+        explicit Group(ComponentPool<Owned>*... pools) : pools_(pools...)
+        {
+            // Aligne les entités déjà présentes avant de prendre les pools
+            refresh();
+            ((pools->group = this), ...);
+        }
+
+        size_t size() const
+        {
+            return length_;
+        }
+
+        bool contains(Entity entity) const
+        {
+            uint32_t element = lead().index_of(entity);
+            return element != SparseSet<Lead>::TOMBSTONE && element < length_;
+        }
+
+        /**
+         * @brief Calls func([entity,] Owned&...) for each member of the group
+         *
+         * Walks [0, size()) from the back, like View::each, so the callback
+         * may remove components from (or destroy) the visited entity.
+         */
+        template <typename Func>
+        void each(Func&& func)
+        {
+            for (size_t i = length_; i-- > 0;) {
+                if (i >= length_)
+                    continue;
+                if constexpr (std::is_invocable_v<Func&, Entity, Owned&...>)
+                    func(lead().entities()[i], std::get<ComponentPool<Owned>*>(pools_)->set.unchecked_at(i)...);
+                else
+                    func(std::get<ComponentPool<Owned>*>(pools_)->set.unchecked_at(i)...);
+            }
+        }
+
+        void on_construct(Entity entity) override
+        {
+            if (!(std::get<ComponentPool<Owned>*>(pools_)->set.has_entity(entity) && ...))
+                return;
+            if (lead().index_of(entity) < length_)
+                return;
+            (swap_into(std::get<ComponentPool<Owned>*>(pools_)->set, entity, length_), ...);
+            length_++;
+        }
+
+        void on_destroy(Entity entity) override
+        {
+            if (!contains(entity))
+                return;
+            length_--;
+            (swap_into(std::get<ComponentPool<Owned>*>(pools_)->set, entity, length_), ...);
+        }
+
+        void refresh() override
+        {
+            const std::pmr::vector<Entity> entities = lead().entities();
+
+            length_ = 0;
+            for (Entity entity : entities)
+                on_construct(entity);
+        }
+
+        void release() override
+        {
+            ((std::get<ComponentPool<Owned>*>(pools_)->group = nullptr), ...);
+            length_ = 0;
+        }
+
+        ComponentMask owned() const override
+        {
+            ComponentMask mask;
+
+            (mask.set(ComponentFamily::id<Owned>()), ...);
+            return mask;
+        }
+
+    private:
+        using Lead = std::tuple_element_t<0, std::tuple<Owned...>>;
+
+        std::tuple<ComponentPool<Owned>*...> pools_;
+        size_t length_ = 0;
+
+        const SparseSet<Lead>& lead() const
+        {
+            return std::get<0>(pools_)->set;
+        }
+
+        template <typename Component>
+        static void swap_into(SparseSet<Component>& set, Entity entity, size_t position)
+        {
+            set.swap_at(set.index_of(entity), position);
+        }
+};
+
+}
+
+#endif /* !GROUP_HPP_ */
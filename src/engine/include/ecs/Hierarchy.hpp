@@ -0,0 +1,286 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** Hierarchy
+*/
+
+#ifndef HIERARCHY_HPP_
+#define HIERARCHY_HPP_
+#include "EntityHandle.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @brief Parent/child links between entities (Registry::set_parent)
+ *
+ * Each entity slot has a node holding its parent, its first child and its
+ * previous/next siblings: the children of an entity form an intrusive
+ * doubly linked list, so linking, unlinking and iterating the children are
+ * O(1) / O(children), with no allocation past the node array growth.
+ *
+ * The entities that have children but no parent (roots) are kept in a
+ * list, so each_link() can walk every tree depth first, parents before
+ * children, touching only the node array.
+ *
+ * Nodes are addressed by slot and remember the full handle they were
+ * linked with: a stale handle reads as unlinked. The Registry removes the
+ * node of a killed entity (its children become parentless).
+ */
+class Hierarchy {
+    public:
+        static constexpr Entity NONE = std::numeric_limits<Entity>::max();
+
+        explicit Hierarchy(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : nodes_(resource), roots_(resource) {}
+
+        /**
+         * @brief Make child the last child of parent, detaching it from its previous parent
+         *
+         * The caller guarantees that parent is not child or one of its descendants.
+         */
+        void link(Entity child, Entity parent)
+        {
+            unlink(child);
+            touch(child);
+            touch(parent);
+            // Références prises après les éventuels agrandissements du tableau
+            Node& node = nodes_[ecs::entity::index(child)];
+            Node& owner = nodes_[ecs::entity::index(parent)];
+
+            node.parent = parent;
+            node.prev = owner.last_child;
+            if (owner.last_child != NONE)
+                nodes_[ecs::entity::index(owner.last_child)].next = child;
+            else
+                owner.first_child = child;
+            owner.last_child = child;
+            owner.children++;
+            // L'enfant n'est plus une racine, le parent peut le devenir
+            update_root(child);
+            update_root(parent);
+        }
+
+        // Détache l'entité de son parent (ses enfants restent attachés à elle)
+        void unlink(Entity child)
+        {
+            Node* node = find(child);
+
+            if (!node || node->parent == NONE)
+                return;
+            Node& owner = nodes_[ecs::entity::index(node->parent)];
+            Entity parent = node->parent;
+
+            if (node->prev != NONE)
+                nodes_[ecs::entity::index(node->prev)].next = node->next;
+            else
+                owner.first_child = node->next;
+            if (node->next != NONE)
+                nodes_[ecs::entity::index(node->next)].prev = node->prev;
+            else
+                owner.last_child = node->prev;
+            owner.children--;
+            node->parent = NONE;
+            node->prev = NONE;
+            node->next = NONE;
+            update_root(parent);
+            update_root(child);
+        }
+
+        /**
+         * @brief Forget the entity: detach it from its parent and orphan its children
+         */
+        void remove(Entity entity)
+        {
+            Node* node = find(entity);
+
+            if (!node)
+                return;
+            unlink(entity);
+            while (node->first_child != NONE)
+                unlink(node->first_child);
+            node->entity = NONE;
+        }
+
+        Entity parent(Entity entity) const
+        {
+            const Node* node = find(entity);
+
+            return node ? node->parent : NONE;
+        }
+
+        size_t child_count(Entity entity) const
+        {
+            const Node* node = find(entity);
+
+            return node ? node->children : 0;
+        }
+
+        // true si ancestor est entity ou l'un de ses ascendants
+        bool is_ancestor(Entity ancestor, Entity entity) const
+        {
+            for (Entity current = entity; current != NONE; current = parent(current))
+                if (current == ancestor)
+                    return true;
+            return false;
+        }
+
+        /**
+         * @brief Calls func(Entity child) for each child of parent, in link order
+         *
+         * func may unlink the visited child, not the others.
+         */
+        template <typename Func>
+        void each_child(Entity parent, Func&& func) const
+        {
+            const Node* node = find(parent);
+
+            for (Entity child = node ? node->first_child : NONE; child != NONE;) {
+                Entity next = nodes_[ecs::entity::index(child)].next;
+                func(child);
+                child = next;
+            }
+        }
+
+        /**
+         * @brief Calls func(Entity parent, Entity child) for each link under root,
+         * depth first, a parent always before its children
+         */
+        template <typename Func>
+        void each_descendant(Entity root, Func&& func) const
+        {
+            const Node* top = find(root);
+            Entity current = top ? top->first_child : NONE;
+
+            while (current != NONE) {
+                const Node& node = nodes_[ecs::entity::index(current)];
+
+                func(node.parent, current);
+                if (node.first_child != NONE) {
+                    current = node.first_child;
+                    continue;
+                }
+                // Remonte jusqu'au premier ascendant qui a un frère suivant
+                while (current != root && nodes_[ecs::entity::index(current)].next == NONE)
+                    current = nodes_[ecs::entity::index(current)].parent;
+                current = current == root ? NONE : nodes_[ecs::entity::index(current)].next;
+            }
+        }
+
+        /**
+         * @brief Calls func(Entity parent, Entity child) for every link, a parent
+         * always before its children (one pass propagates a whole chain)
+         *
+         * func must not change the links.
+         */
+        template <typename Func>
+        void each_link(Func&& func) const
+        {
+            for (Entity root : roots_)
+                each_descendant(root, func);
+        }
+
+        /**
+         * @brief Remove the nodes of the entities for which alive(Entity) is false
+         */
+        template <typename Alive>
+        void retain(Alive&& alive)
+        {
+            for (const Node& node : nodes_)
+                if (node.entity != NONE && !alive(node.entity))
+                    remove(node.entity);
+        }
+
+        void clear()
+        {
+            nodes_.clear();
+            roots_.clear();
+        }
+
+        // Nombre d'arbres (entités avec enfants et sans parent)
+        size_t root_count() const
+        {
+            return roots_.size();
+        }
+
+    private:
+        static constexpr uint32_t NOT_ROOT = UINT32_MAX;
+
+        struct Node {
+            Entity entity = NONE;
+            Entity parent = NONE;
+            Entity first_child = NONE;
+            Entity last_child = NONE;
+            Entity prev = NONE;
+            Entity next = NONE;
+            uint32_t children = 0;
+            // Position dans roots_, NOT_ROOT sinon
+            uint32_t root = NOT_ROOT;
+        };
+
+        // Indexé par slot d'entité
+        std::pmr::vector<Node> nodes_;
+        std::pmr::vector<Entity> roots_;
+
+        Node* find(Entity entity)
+        {
+            uint32_t slot = ecs::entity::index(entity);
+
+            if (slot >= nodes_.size() || nodes_[slot].entity != entity)
+                return nullptr;
+            return &nodes_[slot];
+        }
+
+        const Node* find(Entity entity) const
+        {
+            uint32_t slot = ecs::entity::index(entity);
+
+            if (slot >= nodes_.size() || nodes_[slot].entity != entity)
+                return nullptr;
+            return &nodes_[slot];
+        }
+
+        // Nœud de l'entité, réinitialisé si le slot appartenait à un autre handle
+        Node& touch(Entity entity)
+        {
+            uint32_t slot = ecs::entity::index(entity);
+
+            if (slot >= nodes_.size())
+                nodes_.resize(slot + 1);
+            if (nodes_[slot].entity != entity) {
+                if (nodes_[slot].entity != NONE)
+                    remove(nodes_[slot].entity);
+                nodes_[slot] = Node{};
+                nodes_[slot].entity = entity;
+            }
+            return nodes_[slot];
+        }
+
+        // Une racine a des enfants et pas de parent
+        void update_root(Entity entity)
+        {
+            Node& node = nodes_[ecs::entity::index(entity)];
+            bool is_root = node.children > 0 && node.parent == NONE;
+
+            if (is_root && node.root == NOT_ROOT) {
+                node.root = static_cast<uint32_t>(roots_.size());
+                roots_.push_back(entity);
+            } else if (!is_root && node.root != NOT_ROOT) {
+                Entity last = roots_.back();
+
+                roots_[node.root] = last;
+                nodes_[ecs::entity::index(last)].root = node.root;
+                roots_.pop_back();
+                node.root = NOT_ROOT;
+            }
+        }
+};
+
+}
+
+#endif /* !HIERARCHY_HPP_ */
@@ -0,0 +1,141 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** Observer
+*/
+
+#ifndef OBSERVER_HPP_
+#define OBSERVER_HPP_
+#include "SparseSet.hpp"
+#include "ComponentMask.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @brief Entity set kept up to date by the on_construct/on_destroy signals
+ *
+ * Holds the entities owning all the include components and none of the
+ * exclude ones, like a View would visit them, but maintained incrementally:
+ * each add/remove of a watched component costs one signature test, and
+ * reading the set costs nothing. Use it for the entity lists a system would
+ * otherwise rebuild from a full pool scan every tick.
+ *
+ * Created and owned by the Registry (Registry::observer), which fills it
+ * with the existing entities and rebuilds it after a snapshot load. The
+ * order is the order in which entities joined, minus swap-removes.
+ *
+ * @code
+ * ecs::Observer& players = registry.observer<Position, Controllable>(ecs::exclude<ToDestroy>);
+ * for (Entity e : players.entities()) { ... }
+ * @endcode
+ */
+class Observer {
+    public:
+        Observer(const std::vector<ComponentMask>& signatures, ComponentMask include, ComponentMask exclude,
+            std::pmr::memory_resource* resource)
+            : signatures_(signatures), include_(include), exclude_(exclude), members_(resource) {}
+
+        // Appelé après l'ajout d'un composant de la famille
+        void on_construct(size_t family, Entity entity)
+        {
+            if (exclude_.test(family))
+                members_.erase(entity);
+            else if (matches(signature_of(entity)))
+                members_.insert_at(entity, Member{});
+        }
+
+        // Appelé avant le retrait : la signature contient encore la famille
+        void on_destroy(size_t family, Entity entity)
+        {
+            if (include_.test(family)) {
+                members_.erase(entity);
+                return;
+            }
+            ComponentMask after = signature_of(entity);
+
+            after.reset(family);
+            if (matches(after))
+                members_.insert_at(entity, Member{});
+        }
+
+        /**
+         * @brief Recompute the set from candidates (entities of one include pool)
+         */
+        void rebuild(const std::pmr::vector<Entity>& candidates)
+        {
+            while (members_.size() > 0)
+                members_.erase(members_.entities().back());
+            for (Entity entity : candidates)
+                if (matches(signature_of(entity)))
+                    members_.insert_at(entity, Member{});
+        }
+
+        const std::pmr::vector<Entity>& entities() const
+        {
+            return members_.entities();
+        }
+
+        size_t size() const
+        {
+            return members_.size();
+        }
+
+        bool contains(Entity entity) const
+        {
+            return members_.has_entity(entity);
+        }
+
+        /**
+         * @brief Calls func(Entity) for each member, back to front
+         *
+         * The visited entity may leave the set during the call (component
+         * removed, entity killed), entities joining it are not visited.
+         */
+        template <typename Func>
+        void each(Func&& func) const
+        {
+            for (size_t i = members_.size(); i > 0; i--) {
+                if (i <= members_.size())
+                    func(members_.entities()[i - 1]);
+            }
+        }
+
+        ComponentMask include() const
+        {
+            return include_;
+        }
+
+        ComponentMask exclude() const
+        {
+            return exclude_;
+        }
+
+    private:
+        // Appartenance seule : aucun stockage par entité
+        struct Member {};
+
+        const std::vector<ComponentMask>& signatures_;
+        ComponentMask include_;
+        ComponentMask exclude_;
+        SparseSet<Member> members_;
+
+        ComponentMask signature_of(Entity entity) const
+        {
+            uint32_t slot = ecs::entity::index(entity);
+
+            return slot < signatures_.size() ? signatures_[slot] : ComponentMask{};
+        }
+
+        bool matches(const ComponentMask& signature) const
+        {
+            return signature.contains(include_) && !signature.intersects(exclude_);
+        }
+};
+
+}
+
+#endif /* !OBSERVER_HPP_ */
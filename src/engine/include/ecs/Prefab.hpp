@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** Prefab
+*/
+
+#ifndef PREFAB_HPP_
+#define PREFAB_HPP_
+#include "ComponentPool.hpp"
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class Registry;
+
+namespace ecs {
+
+/**
+ * @brief Type-erased template value of one component of a Prefab
+ */
+class IPrefabComponent {
+    public:
+        virtual ~IPrefabComponent() = default;
+
+        virtual size_t family() const = 0;
+        // Ajoute une copie du modèle à count entités, pool réservé une seule fois
+        virtual void instantiate(Registry& registry, const Entity* entities, size_t count) const = 0;
+};
+
+template <typename Component>
+class PrefabComponent : public IPrefabComponent {
+    public:
+        Component value;
+
+        explicit PrefabComponent(Component component) : value(std::move(component)) {}
+
+        size_t family() const override
+        {
+            return ComponentFamily::id<Component>();
+        }
+
+        // Défini dans Registry.hpp
+        void instantiate(Registry& registry, const Entity* entities, size_t count) const override;
+};
+
+/**
+ * @brief Blueprint of an entity: a set of component values copied on instantiation
+ *
+ * Built once (usually at init), then stamped with Registry::instantiate or
+ * CommandBuffer::instantiate. Instantiating count entities spawns them in
+ * one go, then fills the prefab components pool by pool (one reservation
+ * per pool), before an optional initializer sets the per-entity values.
+ *
+ * @code
+ * ecs::Prefab bullet;
+ * bullet.with(Position{}).with(Velocity{}).with(NoFriction{});
+ * registry.instantiate<Velocity>(bullet, 64, [](size_t i, Entity, Velocity& vel) { ... });
+ * @endcode
+ */
+class Prefab {
+    public:
+        /**
+         * @brief Add a component value (replacing the previous one of that type)
+         */
+        template <typename Component>
+        Prefab& with(Component&& component)
+        {
+            using ComponentType = std::decay_t<Component>;
+            auto entry = std::make_unique<PrefabComponent<ComponentType>>(std::forward<Component>(component));
+
+            for (auto& existing : components_) {
+                if (existing->family() == entry->family()) {
+                    existing = std::move(entry);
+                    return *this;
+                }
+            }
+            components_.push_back(std::move(entry));
+            return *this;
+        }
+
+        /**
+         * @brief Template value of a component, nullptr if the prefab does not have it
+         */
+        template <typename Component>
+        const Component* get() const
+        {
+            for (const auto& entry : components_)
+                if (entry->family() == ComponentFamily::id<Component>())
+                    return &static_cast<const PrefabComponent<Component>*>(entry.get())->value;
+            return nullptr;
+        }
+
+        size_t size() const
+        {
+            return components_.size();
+        }
+
+        // Ajoute tous les composants du prefab aux count entités données
+        void instantiate(Registry& registry, const Entity* entities, size_t count) const
+        {
+            for (const auto& entry : components_)
+                entry->instantiate(registry, entities, count);
+        }
+
+    private:
+        std::vector<std::unique_ptr<IPrefabComponent>> components_;
+};
+
+}
+
+#endif /* !PREFAB_HPP_ */
@@ -8,42 +8,350 @@
 #ifndef REGISTRY_HPP_
 #define REGISTRY_HPP_
 #include "SparseSet.hpp"
+#include "ComponentPool.hpp"
+#include "ComponentMask.hpp"
+#include "View.hpp"
+#include "Group.hpp"
+#include "Archetype.hpp"
+#include "CommandBuffer.hpp"
+#include "Prefab.hpp"
+#include "Observer.hpp"
+#include "Hierarchy.hpp"
+#include "SystemScheduler.hpp"
+#include "SystemProfiler.hpp"
 #include "systems/ISystem.hpp"
 #include "core/event/EventBus.hpp"
-#include <unordered_map>
+#include <algorithm>
 #include <any>
-#include <typeindex>
+#include <chrono>
+#include <cstring>
+#include <limits>
 #include <typeinfo>
 #include <type_traits>
 #include <functional>
 #include <memory>
+#include <memory_resource>
+#include <stdexcept>
 
 class Registry {
     private:
-        size_t next_entity_id = 0;
-        std::unordered_map<std::type_index, std::any> components;
-        std::vector<std::function<void (Registry&, Entity)>> to_kill;
-        std::vector<std::unique_ptr<ISystem>> systems;
+        std::vector<uint32_t> generations;
+        std::vector<uint32_t> free_indices;
+        // Signature de chaque slot : un bit par type de composant possédé
+        std::vector<ecs::ComponentMask> signatures;
+        // Indexé par ecs::ComponentFamily::id<Component>(), nullptr si non enregistré
+        std::vector<std::unique_ptr<ecs::IComponentPool>> pools;
+        std::vector<std::unique_ptr<ecs::IGroup>> groups;
+        // Ensembles d'entités tenus à jour par les signaux des pools
+        std::vector<std::unique_ptr<ecs::Observer>> observers_;
+        // Ressource des tableaux de tous les pools, doit survivre au Registry
+        std::pmr::memory_resource* resource_;
+        // Liens parent/enfant (set_parent), nœuds indexés par slot
+        ecs::Hierarchy hierarchy_;
+        // Table des archétypes, nullptr avec le stockage SparseSet (par défaut)
+        std::unique_ptr<ecs::ArchetypeIndex> archetypes_;
+        struct SystemSlot {
+            std::unique_ptr<ISystem> system;
+            size_t family;
+            bool enabled;
+            // Relevé une fois à l'enregistrement (ordonnancement et profil)
+            ecs::SystemAccess access;
+            std::string name;
+            ecs::TickHistogram timings;
+            size_t entities;
+        };
+        // Ordre d'enregistrement = ordre d'exécution
+        std::vector<SystemSlot> systems;
+        // Indexé par ecs::SystemFamily::id<System>(), nullptr si non enregistré
+        std::vector<ISystem*> system_index_;
         core::EventBus eventBus_;
+        ecs::CommandBuffer commands_;
+        // Horloge partagée par tous les pools pour le suivi des modifications
+        uint32_t change_tick_ = 1;
+
+        // Exécution parallèle : ordonnanceur et un buffer de commandes par système
+        ecs::ExecutionMode execution_mode_ = ecs::ExecutionMode::Serial;
+        std::unique_ptr<ecs::SystemScheduler> scheduler_;
+        std::vector<ecs::CommandBuffer> system_commands_;
+        bool schedule_dirty_ = true;
+        bool profiling_ = true;
+
+        // Buffer utilisé par commands() sur le thread courant pendant un étage parallèle
+        struct ThreadCommands {
+            const Registry* owner = nullptr;
+            ecs::CommandBuffer* buffer = nullptr;
+        };
+
+        static ThreadCommands& thread_commands()
+        {
+            static thread_local ThreadCommands current;
+            return current;
+        }
+
+        void run_system_with_buffer(size_t index, float dt)
+        {
+            ThreadCommands& current = thread_commands();
+            ThreadCommands previous = current;
+
+            current = {this, &system_commands_[index]};
+            try {
+                update_system(systems[index], dt);
+            } catch (...) {
+                current = previous;
+                throw;
+            }
+            current = previous;
+        }
+
+        // Exécute un système, en mesurant son temps si le profilage est actif
+        void update_system(SystemSlot& slot, float dt)
+        {
+            if (!profiling_) {
+                slot.system->update(*this, dt);
+                return;
+            }
+            auto start = std::chrono::steady_clock::now();
+            slot.system->update(*this, dt);
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            slot.timings.record(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            slot.entities = touched_entities(slot.access);
+        }
+
+        // Taille du plus petit pool déclaré : ce qu'une vue sur ces composants parcourt
+        size_t touched_entities(const ecs::SystemAccess& access) const
+        {
+            size_t smallest = std::numeric_limits<size_t>::max();
+
+            access.for_each_component([&](size_t family) {
+                if (family < pools.size() && pools[family])
+                    smallest = std::min(smallest, pools[family]->entities().size());
+            });
+            return smallest == std::numeric_limits<size_t>::max() ? 0 : smallest;
+        }
+
+        void run_systems_parallel(float dt)
+        {
+            if (schedule_dirty_) {
+                // Un système désactivé garde un accès vide : il ne bloque personne
+                std::vector<ecs::SystemAccess> accesses(systems.size());
+                for (size_t i = 0; i < systems.size(); i++)
+                    if (systems[i].enabled)
+                        accesses[i] = systems[i].access;
+                scheduler_->build(accesses);
+                system_commands_.resize(systems.size());
+                schedule_dirty_ = false;
+            }
+            std::function<void(size_t)> task = [this, dt](size_t index) {
+                if (systems[index].enabled)
+                    run_system_with_buffer(index, dt);
+            };
+            for (const auto& stage : scheduler_->stages()) {
+                scheduler_->run_stage(stage, task);
+                // Point de synchronisation : buffers vidés dans l'ordre d'enregistrement
+                for (size_t index : stage) {
+                    if (!system_commands_[index].empty())
+                        system_commands_[index].flush(*this);
+                }
+                flush_commands();
+            }
+        }
+
+        template <typename Component>
+        ecs::ComponentPool<Component>& get_pool()
+        {
+            size_t family = ecs::ComponentFamily::id<Component>();
+
+            if (family >= pools.size() || !pools[family])
+                throw std::bad_any_cast();
+            return *static_cast<ecs::ComponentPool<Component>*>(pools[family].get());
+        }
+
+        ecs::IComponentPool* find_snapshot_pool(uint32_t key) const
+        {
+            for (const auto& pool : pools) {
+                if (pool && pool->snapshot_key() == key)
+                    return pool.get();
+            }
+            return nullptr;
+        }
+
+        // Après une restauration : retire des pools non sauvegardés les entités
+        // qui ne sont plus vivantes, puis recalcule toutes les signatures
+        void prune_and_rebuild_signatures()
+        {
+            for (auto& signature : signatures)
+                signature.clear();
+            if (signatures.size() < generations.size())
+                signatures.resize(generations.size());
+            for (size_t family = 0; family < pools.size(); ++family) {
+                ecs::IComponentPool* pool = pools[family].get();
+                if (!pool)
+                    continue;
+                if (pool->snapshot_key() == 0) {
+                    const std::pmr::vector<Entity> entities = pool->entities();
+                    for (Entity entity : entities) {
+                        if (!is_alive(entity))
+                            pool->remove(entity);
+                    }
+                }
+                for (Entity entity : pool->entities())
+                    signature_ref(entity).set(family);
+            }
+            if (archetypes_)
+                archetypes_->rebuild(signatures);
+        }
+
+        ecs::ComponentMask& signature_ref(Entity entity)
+        {
+            uint32_t slot = ecs::entity::index(entity);
+
+            if (slot >= signatures.size())
+                signatures.resize(slot + 1);
+            return signatures[slot];
+        }
+
+        // Met à jour la signature, et la table des archétypes si elle existe.
+        // Renvoie false si le bit avait déjà cette valeur (composant remplacé)
+        bool set_signature_bit(Entity entity, size_t family, bool value)
+        {
+            ecs::ComponentMask& signature = signature_ref(entity);
+
+            if (signature.test(family) == value)
+                return false;
+            ecs::ComponentMask before = signature;
+            value ? signature.set(family) : signature.reset(family);
+            if (archetypes_)
+                archetypes_->move(entity, before, signature);
+            return true;
+        }
+
+        // Branche l'observateur sur les signaux du pool d'une famille qu'il surveille
+        void watch(ecs::Observer& observer, size_t family)
+        {
+            ecs::Observer* target = &observer;
+
+            pools[family]->on_construct.connect([target, family](Entity entity) {
+                target->on_construct(family, entity);
+            });
+            pools[family]->on_destroy.connect([target, family](Entity entity) {
+                target->on_destroy(family, entity);
+            });
+        }
+
+        // Remplit l'observateur depuis le plus petit de ses pools inclus
+        void refill(ecs::Observer& observer)
+        {
+            ecs::IComponentPool* smallest = nullptr;
+
+            observer.include().for_each([&](size_t family) {
+                if (!smallest || pools[family]->entities().size() < smallest->entities().size())
+                    smallest = pools[family].get();
+            });
+            if (smallest)
+                observer.rebuild(smallest->entities());
+        }
+
+        template <typename... Component>
+        ecs::ComponentMask mask_of() const
+        {
+            ecs::ComponentMask mask;
+
+            ((ecs::ComponentFamily::id<Component>() < ecs::MAX_COMPONENTS
+                ? mask.set(ecs::ComponentFamily::id<Component>()) : void()), ...);
+            return mask;
+        }
+
+        // Un groupe dont un pool est remplacé ne peut plus être maintenu
+        void drop_group(ecs::IGroup* group)
+        {
+            group->release();
+            for (auto it = groups.begin(); it != groups.end(); ++it) {
+                if (it->get() == group) {
+                    groups.erase(it);
+                    return;
+                }
+            }
+        }
     public:
-        Registry() = default;
+        /**
+         * @brief Registry whose component pools allocate from resource
+         *
+         * Every pool array (dense entities, components, change ticks, sparse
+         * pages) comes from resource, e.g. an arena owned by the game session:
+         * entity churn recycles its blocks instead of going through the global
+         * heap, and tearing the session down releases it in one go. resource
+         * must outlive the Registry, and be thread-safe with
+         * ExecutionMode::Parallel. Defaults to the global heap.
+         */
+        explicit Registry(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : resource_(resource), hierarchy_(resource) {}
         ~Registry() = default;
 
+        std::pmr::memory_resource* memory_resource() const {
+            return resource_;
+        }
+
         core::EventBus& get_event_bus() {
             return eventBus_;
         }
 
+        /**
+         * @brief Registry-owned buffer for structural changes recorded mid-iteration
+         *
+         * Flushed by run_systems after each system, or explicitly with
+         * flush_commands().
+         */
+        ecs::CommandBuffer& commands() {
+            ThreadCommands& current = thread_commands();
+
+            if (current.owner == this)
+                return *current.buffer;
+            return commands_;
+        }
+
+        void flush_commands() {
+            if (!commands_.empty())
+                commands_.flush(*this);
+        }
+
         template <typename Component>
         SparseSet<Component>& register_component()
         {
-            std::type_index index = std::type_index(typeid(Component));
+            size_t family = ecs::ComponentFamily::id<Component>();
 
-            components[index] = SparseSet<Component>();
-            to_kill.push_back([this](Registry& r, Entity e){
-                r.remove_component<Component>(e);
-            });
+            if (family >= ecs::MAX_COMPONENTS)
+                throw std::length_error("Too many component types (raise ecs::MAX_COMPONENTS)");
+            if (family >= pools.size())
+                pools.resize(family + 1);
+            if (pools[family] && pools[family]->group)
+                drop_group(pools[family]->group);
+            // Le pool repart vide : plus aucune entité ne possède ce composant
+            bool replaced = pools[family] != nullptr;
+            auto pool = std::make_unique<ecs::ComponentPool<Component>>(resource_);
+            if (replaced) {
+                ecs::IComponentPool& previous = *pools[family];
 
-            return std::any_cast<SparseSet<Component>&>(components[index]);
+                for (Entity entity : previous.entities())
+                    previous.on_destroy.emit(entity);
+                for (auto& signature : signatures)
+                    signature.reset(family);
+                // Les abonnés suivent le composant, pas l'instance du pool
+                pool->on_construct = std::move(previous.on_construct);
+                pool->on_destroy = std::move(previous.on_destroy);
+            }
+            SparseSet<Component>& set = pool->set;
+            set.set_clock(&change_tick_);
+            pools[family] = std::move(pool);
+            if (!replaced) {
+                for (auto& observer : observers_)
+                    if (observer->exclude().test(family))
+                        watch(*observer, family);
+            }
+            if (replaced && archetypes_)
+                archetypes_->rebuild(signatures);
+            return set;
         }
 
         template <typename System, typename... Args>
@@ -53,70 +361,900 @@ class Registry {
             static_assert(std::is_base_of<ISystem, System>::value, "System must inherit from ISystem"); 
             
             auto system = std::make_unique<System>(std::forward<Args>(args)...);
+            size_t family = ecs::SystemFamily::id<System>();
             
             system->init(*this);
-            systems.push_back(std::move(system));
+            if (family >= system_index_.size())
+                system_index_.resize(family + 1, nullptr);
+            // Un type enregistré deux fois : get_system rend le premier
+            if (!system_index_[family])
+                system_index_[family] = system.get();
+            ecs::SystemAccess access;
+            system->declare_access(access);
+            systems.push_back({std::move(system), family, true, access,
+                ecs::readable_type_name(typeid(System).name()), {}, 0});
+            schedule_dirty_ = true;
+        }
+
+        /**
+         * @brief Shut down and remove a system (all instances of that type)
+         *
+         * Must not be called from a system's update(): run_systems is
+         * iterating over the system list.
+         */
+        template <typename System>
+        void remove_system()
+        {
+            size_t family = ecs::SystemFamily::id<System>();
+
+            if (family >= system_index_.size() || !system_index_[family])
+                return;
+            for (SystemSlot& slot : systems)
+                if (slot.family == family)
+                    slot.system->shutdown();
+            std::erase_if(systems, [family](const SystemSlot& slot) { return slot.family == family; });
+            system_index_[family] = nullptr;
+            system_commands_.clear();
+            schedule_dirty_ = true;
         }
 
+        /**
+         * @brief Skip (or run again) a system in run_systems, keeping its state
+         */
+        template <typename System>
+        void set_system_enabled(bool enabled)
+        {
+            size_t family = ecs::SystemFamily::id<System>();
+
+            for (SystemSlot& slot : systems)
+                if (slot.family == family)
+                    slot.enabled = enabled;
+            schedule_dirty_ = true;
+        }
+
+        /**
+         * @brief Enable or disable every registered system at once
+         */
+        void set_all_systems_enabled(bool enabled)
+        {
+            for (SystemSlot& slot : systems)
+                slot.enabled = enabled;
+            schedule_dirty_ = true;
+        }
+
+        template <typename System>
+        bool is_system_enabled() const
+        {
+            size_t family = ecs::SystemFamily::id<System>();
+
+            for (const SystemSlot& slot : systems)
+                if (slot.family == family)
+                    return slot.enabled;
+            return false;
+        }
+
+        /**
+         * @brief Access the pool of a registered component type
+         *
+         * A single array index on the component family id. Throws
+         * std::bad_any_cast (as the previous std::any storage did) if the
+         * component type was never registered.
+         */
         template <typename Component>
         SparseSet<Component>& get_components()
         {
-            std::type_index index = std::type_index(typeid(Component));
+            return get_pool<Component>().set;
+        }
+
+        /**
+         * @brief Build a view over the entities owning all Include components
+         *
+         * Include pools must be registered. Exclude pools that are not
+         * registered are ignored (no entity can own them).
+         *
+         * @code
+         * registry.view<Position, Velocity>(ecs::exclude<NoFriction>)
+         *     .each([](Entity e, Position& pos, Velocity& vel) { ... });
+         * @endcode
+         */
+        template <typename... Include, typename... Exclude>
+        ecs::View<ecs::exclude_t<Exclude...>, Include...> view(ecs::exclude_t<Exclude...> = {})
+        {
+            return ecs::View<ecs::exclude_t<Exclude...>, Include...>(
+                std::make_tuple(&get_components<Include>()...),
+                std::make_tuple(find_components<Exclude>()...),
+                &signatures, mask_of<Include...>(), mask_of<Exclude...>(), archetypes_.get());
+        }
+
+        /**
+         * @brief Get (creating it on first call) the owning group of the Owned components
+         *
+         * From then on the Registry keeps the dense arrays of the Owned pools
+         * aligned on their common entities, see ecs::Group. All Owned types
+         * must be registered, and none of them may already belong to another
+         * group (std::logic_error).
+         *
+         * @code
+         * registry.group<Position, Velocity>()
+         *     .each([](Position& pos, Velocity& vel) { ... });
+         * @endcode
+         */
+        template <typename... Owned>
+        ecs::Group<Owned...>& group()
+        {
+            std::tuple<ecs::ComponentPool<Owned>*...> owned(&get_pool<Owned>()...);
+            ecs::IGroup* existing = std::get<0>(owned)->group;
+
+            if (existing) {
+                if (auto* same = dynamic_cast<ecs::Group<Owned...>*>(existing))
+                    return *same;
+            }
+            if (((std::get<ecs::ComponentPool<Owned>*>(owned)->group != nullptr) || ...))
+                throw std::logic_error("Component already owned by another group");
+            auto created = std::make_unique<ecs::Group<Owned...>>(std::get<ecs::ComponentPool<Owned>*>(owned)...);
+            ecs::Group<Owned...>& ref = *created;
+            groups.push_back(std::move(created));
+            // Le groupe a réordonné ses pools
+            if (archetypes_)
+                archetypes_->mark_dirty(ref.owned());
+            return ref;
+        }
+
+        /**
+         * @brief Signal emitted right after a Component is added to an entity
+         *
+         * Emitted by add_component, emplace_component, add_components and the
+         * prefab/command buffer paths built on them, not when an existing
+         * component is replaced, nor by load_snapshot. The Component type must
+         * be registered; see ecs::Signal for what listeners may do.
+         *
+         * @code
+         * registry.on_construct<Enemy>().connect([](Entity e) { ... });
+         * @endcode
+         */
+        template <typename Component>
+        ecs::Signal& on_construct()
+        {
+            return get_pool<Component>().on_construct;
+        }
+
+        /**
+         * @brief Signal emitted right before a Component is removed from an entity
+         *
+         * Emitted by remove_component and kill_entity (once per owned
+         * component), and for every entity when the component is registered
+         * again. Not emitted by load_snapshot.
+         */
+        template <typename Component>
+        ecs::Signal& on_destroy()
+        {
+            return get_pool<Component>().on_destroy;
+        }
+
+        /**
+         * @brief Get (creating it on first call) the observer of the entities owning
+         * all Include components and none of Exclude
+         *
+         * The observer starts with the matching entities and is then updated
+         * by the pool signals at each structural change, see ecs::Observer.
+         * Include pools must be registered; Exclude pools registered later
+         * are watched from their registration on.
+         *
+         * @code
+         * ecs::Observer& players = registry.observer<Position, Controllable>(ecs::exclude<ToDestroy>);
+         * @endcode
+         */
+        template <typename... Include, typename... Exclude>
+        ecs::Observer& observer(ecs::exclude_t<Exclude...> = {})
+        {
+            static_assert(sizeof...(Include) > 0, "An observer needs at least one included component");
+            ecs::ComponentMask include = mask_of<Include...>();
+            ecs::ComponentMask exclude = mask_of<Exclude...>();
+
+            for (auto& existing : observers_)
+                if (existing->include() == include && existing->exclude() == exclude)
+                    return *existing;
+            ((void)get_pool<Include>(), ...);
+            auto created = std::make_unique<ecs::Observer>(signatures, include, exclude, resource_);
+            ecs::Observer& ref = *created;
 
-            return std::any_cast<SparseSet<Component>&>(components[index]);
+            include.for_each([&](size_t family) { watch(ref, family); });
+            exclude.for_each([&](size_t family) {
+                if (family < pools.size() && pools[family])
+                    watch(ref, family);
+            });
+            refill(ref);
+            observers_.push_back(std::move(created));
+            return ref;
+        }
+
+        /**
+         * @brief Sort the dense arrays of a pool in place by compare(const Component&, const Component&)
+         *
+         * Iterating the pool (get_entity_at / get_data_at) then follows that
+         * order, until components are added or removed. Re-sorting every
+         * frame with SortMode::Incremental is an allocation-free insertion
+         * sort, linear when only a few entities moved since the last sort.
+         * A pool owned by a group cannot be sorted (std::logic_error). With
+         * the archetype backend, the pool is no longer reordered by archetype.
+         *
+         * @code
+         * registry.sort<Sprite>([](const Sprite& a, const Sprite& b) { return a.layer < b.layer; },
+         *     ecs::SortMode::Incremental);
+         * @endcode
+         */
+        template <typename Component, typename Compare>
+        void sort(Compare compare, ecs::SortMode mode = ecs::SortMode::Full)
+        {
+            ecs::ComponentPool<Component>& pool = get_pool<Component>();
+
+            if (pool.group)
+                throw std::logic_error("Cannot sort a pool owned by a group");
+            if (archetypes_)
+                archetypes_->pin(ecs::ComponentFamily::id<Component>());
+            if (mode == ecs::SortMode::Incremental)
+                pool.set.sort_incremental(compare);
+            else
+                pool.set.sort(compare);
+        }
+
+        /**
+         * @brief Pointer to the pool of a component type, nullptr if not registered
+         */
+        template <typename Component>
+        SparseSet<Component>* find_components()
+        {
+            size_t family = ecs::ComponentFamily::id<Component>();
+
+            if (family >= pools.size() || !pools[family])
+                return nullptr;
+            return &static_cast<ecs::ComponentPool<Component>*>(pools[family].get())->set;
         }
 
         template <typename Component>
         bool has_component_registered() const
         {
-            std::type_index index = std::type_index(typeid(Component));
-            return components.find(index) != components.end();
+            size_t family = ecs::ComponentFamily::id<Component>();
+            return family < pools.size() && pools[family] != nullptr;
         }
 
+        /**
+         * @brief Add (or replace) a component of a live entity
+         *
+         * A dead or stale handle is a no-op, like kill_entity: the slot may
+         * already belong to another entity.
+         */
         template <typename Component>
         void add_component(Entity entity, Component&& component)
         {
             using ComponentType = std::decay_t<Component>;
 
-            SparseSet<ComponentType>& sparseset = get_components<ComponentType>();
+            ecs::ComponentPool<ComponentType>& pool = get_pool<ComponentType>();
+
+            if (!is_alive(entity))
+                return;
+            pool.set.insert_at(entity, std::forward<Component>(component));
+            bool added = set_signature_bit(entity, ecs::ComponentFamily::id<ComponentType>(), true);
+            if (pool.group)
+                pool.group->on_construct(entity);
+            if (added)
+                pool.on_construct.emit(entity);
+        }
+
+        /**
+         * @brief Construct a component in place from its constructor (or aggregate) arguments
+         *
+         * Avoids the temporary + move of add_component, e.g.
+         * registry.emplace_component<Position>(entity, 10.0f, 20.0f).
+         * Throws std::logic_error on a dead or stale handle (no component to return).
+         */
+        template <typename Component, typename... Args>
+        Component& emplace_component(Entity entity, Args&&... args)
+        {
+            ecs::ComponentPool<Component>& pool = get_pool<Component>();
+
+            if (!is_alive(entity))
+                throw std::logic_error("Cannot emplace a component on a dead entity");
+            Component& component = pool.set.emplace(entity, std::forward<Args>(args)...);
+
+            bool added = set_signature_bit(entity, ecs::ComponentFamily::id<Component>(), true);
+            if (pool.group)
+                pool.group->on_construct(entity);
+            if (added)
+                pool.on_construct.emit(entity);
+            // Le groupe peut déplacer le composant dans le tableau dense
+            return pool.group ? *pool.set.find(entity) : component;
+        }
+
+        /**
+         * @brief Add a copy of component to count entities, reserving the pool once
+         *
+         * Dead or stale handles are skipped.
+         */
+        template <typename Component>
+        void add_components(const Entity* entities, size_t count, const Component& component)
+        {
+            ecs::ComponentPool<Component>& pool = get_pool<Component>();
+            size_t family = ecs::ComponentFamily::id<Component>();
+
+            pool.set.reserve(pool.set.size() + count);
+            for (size_t i = 0; i < count; i++) {
+                if (!is_alive(entities[i]))
+                    continue;
+                pool.set.insert_at(entities[i], component);
+                bool added = set_signature_bit(entities[i], family, true);
+                if (pool.group)
+                    pool.group->on_construct(entities[i]);
+                if (added)
+                    pool.on_construct.emit(entities[i]);
+            }
+        }
+
+        /**
+         * @brief Spawn count entities from a prefab, then call init on each of them
+         *
+         * Entities are spawned in one go and the prefab components are added
+         * pool by pool (see ecs::Prefab). init(index, entity, Components&...)
+         * then sets the per-entity values; every listed component must be in
+         * the prefab (std::logic_error). Like add_component, it must not run
+         * while a view over the touched pools is being walked: record it in
+         * commands() instead.
+         *
+         * @code
+         * registry.instantiate<Velocity>(bullet, 64, [&](size_t i, Entity, Velocity& vel) {
+         *     vel = {std::cos(i * step) * speed, std::sin(i * step) * speed};
+         * });
+         * @endcode
+         */
+        template <typename... Components, typename Init>
+        void instantiate(const ecs::Prefab& prefab, size_t count, Init&& init)
+        {
+            std::vector<Entity> entities;
+
+            spawn_entities(count, entities);
+            instantiate_at<Components...>(prefab, entities.data(), count, init);
+        }
+
+        Entity instantiate(const ecs::Prefab& prefab)
+        {
+            Entity entity = spawn_entity();
+
+            prefab.instantiate(*this, &entity, 1);
+            return entity;
+        }
+
+        /**
+         * @brief Stamp a prefab on already spawned entities (CommandBuffer::flush)
+         *
+         * Dead or stale handles are skipped.
+         */
+        template <typename... Components, typename Init>
+        void instantiate_at(const ecs::Prefab& prefab, const Entity* entities, size_t count, Init&& init)
+        {
+            if (((prefab.get<Components>() == nullptr) || ...))
+                throw std::logic_error("Prefab initializer needs a component the prefab does not have");
+            if (signatures.size() < generations.size())
+                signatures.resize(generations.size());
+            prefab.instantiate(*this, entities, count);
+            // Les entités mortes n'ont rien reçu (add_components les ignore)
+            for (size_t i = 0; i < count; i++)
+                if (is_alive(entities[i]))
+                    init(i, entities[i], *get_components<Components>().find(entities[i])...);
+        }
 
-            sparseset.insert_at(entity, std::forward<Component>(component));
+        /**
+         * @brief Modify a component through fn(component) and mark it as changed
+         *
+         * Plain mutable access does not mark anything; writers of a tracked
+         * component go through patch() so incremental consumers see the change.
+         *
+         * @code
+         * registry.patch<Health>(entity, [](Health& health) { health.current -= 10; });
+         * @endcode
+         */
+        template <typename Component, typename Func>
+        Component& patch(Entity entity, Func&& fn)
+        {
+            return get_components<Component>().patch(entity, std::forward<Func>(fn));
+        }
+
+        /**
+         * @brief Current value of the change clock stamped on added or patched components
+         */
+        uint32_t change_tick() const
+        {
+            return change_tick_;
+        }
+
+        /**
+         * @brief Close the current change period and return its tick
+         *
+         * An incremental consumer keeps the value returned by its previous call
+         * and iterates changed_since(previous): every component added or patched
+         * since then has a strictly greater tick. Not thread-safe: call it from
+         * a serial system or outside run_systems.
+         *
+         * @code
+         * uint32_t since = last_tick_;
+         * last_tick_ = registry.advance_change_tick();
+         * registry.get_components<Health>().changed_since(since, [](Entity e, Health& health) { ... });
+         * @endcode
+         */
+        uint32_t advance_change_tick()
+        {
+            return change_tick_++;
         }
 
         template <typename Component>
         void remove_component(Entity entity)
         {
-            SparseSet<Component>& sparseset = get_components<Component>();
+            ecs::ComponentPool<Component>& pool = get_pool<Component>();
 
-            sparseset.erase(entity);
+            if (!pool.set.has_entity(entity))
+                return;
+            pool.on_destroy.emit(entity);
+            if (pool.group)
+                pool.group->on_destroy(entity);
+            pool.set.erase(entity);
+            set_signature_bit(entity, ecs::ComponentFamily::id<Component>(), false);
         }
 
+        /**
+         * @brief Create a new entity, recycling the slot of a killed one if any
+         *
+         * Recycled slots come back with a bumped generation so the returned
+         * handle never compares equal to a handle of the previous occupant.
+         */
         Entity spawn_entity()
         {
-            return next_entity_id++;
+            if (!free_indices.empty()) {
+                uint32_t slot = free_indices.back();
+                free_indices.pop_back();
+                return ecs::entity::make(slot, generations[slot]);
+            }
+            uint32_t slot = static_cast<uint32_t>(generations.size());
+            generations.push_back(0);
+            return ecs::entity::make(slot, 0);
+        }
+
+        /**
+         * @brief Create count entities at once and append their handles to out
+         *
+         * Recycled slots are used first, then the generation table grows in a
+         * single resize.
+         */
+        void spawn_entities(size_t count, std::vector<Entity>& out)
+        {
+            out.reserve(out.size() + count);
+            for (; count > 0 && !free_indices.empty(); count--) {
+                uint32_t slot = free_indices.back();
+                free_indices.pop_back();
+                out.push_back(ecs::entity::make(slot, generations[slot]));
+            }
+            uint32_t first = static_cast<uint32_t>(generations.size());
+            generations.resize(generations.size() + count, 0);
+            for (uint32_t i = 0; i < count; i++)
+                out.push_back(ecs::entity::make(first + i, 0));
+        }
+
+        /**
+         * @brief Check that a handle refers to a live entity (not killed, not stale)
+         */
+        bool is_alive(Entity entity) const
+        {
+            uint32_t slot = ecs::entity::index(entity);
+            return slot < generations.size() && generations[slot] == ecs::entity::generation(entity);
+        }
+
+        /**
+         * @brief Number of entity slots ever allocated (live + recyclable)
+         */
+        size_t entity_capacity() const
+        {
+            return generations.size();
         }
 
+        /**
+         * @brief Destroy an entity: remove its components and recycle its slot
+         *
+         * Only the pools listed in the entity signature are visited, so the
+         * cost depends on the components the entity owns, not on the number
+         * of registered component types. A stale handle is a no-op.
+         */
         void kill_entity(Entity entity)
         {
-            for (auto& cleaner : to_kill)
-                cleaner(*this, entity);
+            uint32_t slot = ecs::entity::index(entity);
+
+            // Killing a stale handle twice must not touch the new occupant
+            if (slot < generations.size() && generations[slot] != ecs::entity::generation(entity))
+                return;
+            if (slot < signatures.size()) {
+                ecs::ComponentMask owned = signatures[slot];
+
+                // Signature retirée composant par composant : les observateurs
+                // voient l'entité perdre ses composants un à un
+                owned.for_each([this, entity, slot](size_t family) {
+                    ecs::IComponentPool* pool = pools[family].get();
+                    if (pool) {
+                        pool->on_destroy.emit(entity);
+                        if (pool->group)
+                            pool->group->on_destroy(entity);
+                        pool->remove(entity);
+                    }
+                    signatures[slot].reset(family);
+                });
+                if (archetypes_ && !owned.none())
+                    archetypes_->move(entity, owned, {});
+                signatures[slot].clear();
+            }
+            hierarchy_.remove(entity);
+
+            // Ids bruts jamais créés par spawn_entity : pas de slot à recycler
+            if (!is_alive(entity))
+                return;
+            generations[slot]++;
+            free_indices.push_back(slot);
+        }
+
+        /**
+         * @brief Attach child under parent (ecs::Hierarchy::NONE detaches it)
+         *
+         * An entity has at most one parent; setting a new one moves it with
+         * its whole subtree. Killing the parent detaches its children, use
+         * kill_hierarchy to destroy them along. Throws std::logic_error if
+         * parent is child itself or one of its descendants. Linking a dead or
+         * stale handle is a no-op: its slot may belong to another entity.
+         */
+        void set_parent(Entity child, Entity parent)
+        {
+            if (parent == ecs::Hierarchy::NONE) {
+                hierarchy_.unlink(child);
+                return;
+            }
+            if (!is_alive(child) || !is_alive(parent))
+                return;
+            if (hierarchy_.is_ancestor(child, parent))
+                throw std::logic_error("Entity cannot be attached under itself or its descendants");
+            hierarchy_.link(child, parent);
+        }
+
+        // Parent de l'entité, ecs::Hierarchy::NONE si elle n'en a pas
+        Entity parent_of(Entity entity) const
+        {
+            return hierarchy_.parent(entity);
+        }
+
+        /**
+         * @brief Calls func(Entity child) for each child of parent, O(children)
+         */
+        template <typename Func>
+        void each_child(Entity parent, Func&& func) const
+        {
+            hierarchy_.each_child(parent, std::forward<Func>(func));
+        }
+
+        /**
+         * @brief Calls func(Entity parent, Entity child) for every parent/child link,
+         * a parent always before its children
+         *
+         * A transform propagation pass over it updates whole chains (player ->
+         * companion -> muzzle flash) in one sweep. func may change components
+         * but not the links.
+         */
+        template <typename Func>
+        void each_link(Func&& func) const
+        {
+            hierarchy_.each_link(std::forward<Func>(func));
+        }
+
+        /**
+         * @brief Kill an entity and all its descendants
+         */
+        void kill_hierarchy(Entity root)
+        {
+            std::vector<Entity> doomed{root};
+
+            hierarchy_.each_descendant(root, [&doomed](Entity, Entity child) { doomed.push_back(child); });
+            for (Entity entity : doomed)
+                kill_entity(entity);
+        }
+
+        const ecs::Hierarchy& hierarchy() const
+        {
+            return hierarchy_;
+        }
+
+        /**
+         * @brief Append the entity allocator and every opted-in pool to out
+         *
+         * Only components declared with ECS_SNAPSHOT_COMPONENT are written, as
+         * raw copies of their dense arrays, so the cost is a few memcpy per
+         * pool. Reusing the same out buffer every tick avoids reallocating.
+         * Pending commands are not captured: call it between two ticks.
+         */
+        void save_snapshot(std::vector<uint8_t>& out)
+        {
+            namespace snap = ecs::snapshot;
+            uint32_t pool_count = 0;
+
+            snap::write(out, snap::MAGIC);
+            snap::write(out, snap::VERSION);
+            snap::write<uint64_t>(out, generations.size());
+            snap::write_bytes(out, generations.data(), generations.size() * sizeof(uint32_t));
+            snap::write<uint64_t>(out, free_indices.size());
+            snap::write_bytes(out, free_indices.data(), free_indices.size() * sizeof(uint32_t));
+
+            size_t count_offset = out.size();
+            snap::write(out, pool_count);
+            for (auto& pool : pools) {
+                if (!pool || pool->snapshot_key() == 0)
+                    continue;
+                snap::write(out, pool->snapshot_key());
+                snap::write(out, static_cast<uint32_t>(pool->snapshot_stride()));
+                pool->save(out);
+                pool_count++;
+            }
+            std::memcpy(out.data() + count_offset, &pool_count, sizeof(pool_count));
+        }
+
+        std::vector<uint8_t> save_snapshot()
+        {
+            std::vector<uint8_t> out;
+            save_snapshot(out);
+            return out;
+        }
+
+        /**
+         * @brief Restore the state written by save_snapshot
+         *
+         * The blob is fully validated first (std::runtime_error, registry
+         * untouched): lengths and layouts, free slots inside the generation
+         * table and unique, and pool entities alive in the restored allocator
+         * and unique per pool. Then the allocator and every opted-in pool are replaced;
+         * opted-in pools missing from the blob are emptied, records of
+         * components not registered here are skipped. Pools that do not take
+         * part in snapshots keep their content, minus the entities that are
+         * no longer alive. Signatures and groups are rebuilt, and every
+         * restored component is marked as changed.
+         */
+        void load_snapshot(const uint8_t* bytes, size_t size)
+        {
+            namespace snap = ecs::snapshot;
+            struct Record {
+                ecs::IComponentPool* pool;
+                size_t count;
+                size_t offset;
+            };
+            snap::Reader in(bytes, size);
+            auto read_slots = [&in]() {
+                uint64_t count = in.read<uint64_t>();
+                if (count > in.remaining() / sizeof(uint32_t))
+                    throw std::runtime_error("Truncated registry snapshot");
+                std::vector<uint32_t> slots(count);
+                const uint8_t* src = in.take(count * sizeof(uint32_t));
+                if (count > 0)
+                    std::memcpy(slots.data(), src, count * sizeof(uint32_t));
+                return slots;
+            };
+
+            if (in.read<uint32_t>() != snap::MAGIC || in.read<uint32_t>() != snap::VERSION)
+                throw std::runtime_error("Invalid registry snapshot");
+            std::vector<uint32_t> restored_generations = read_slots();
+            std::vector<uint32_t> restored_free = read_slots();
+
+            // Emplacements libres : dans la table des générations, sans doublon
+            std::vector<uint8_t> free_slot(restored_generations.size(), 0);
+            for (uint32_t slot : restored_free) {
+                if (slot >= restored_generations.size() || free_slot[slot])
+                    throw std::runtime_error("Corrupted registry snapshot");
+                free_slot[slot] = 1;
+            }
+
+            std::vector<Record> records;
+            // Dernier enregistrement (1-based) ayant vu chaque slot : doublons intra-pool
+            std::vector<uint32_t> seen_by(restored_generations.size(), 0);
+            uint32_t pool_count = in.read<uint32_t>();
+            for (uint32_t i = 0; i < pool_count; ++i) {
+                uint32_t key = in.read<uint32_t>();
+                uint32_t stride = in.read<uint32_t>();
+                uint64_t count = in.read<uint64_t>();
+                ecs::IComponentPool* target = find_snapshot_pool(key);
+
+                if (stride == 0 || count > in.remaining() / stride)
+                    throw std::runtime_error("Truncated registry snapshot");
+                if (target && target->snapshot_stride() != stride)
+                    throw std::runtime_error("Registry snapshot component layout mismatch");
+                if (target)
+                    records.push_back({target, static_cast<size_t>(count), size - in.remaining()});
+                // Les entités du pool précèdent ses composants
+                const uint8_t* entities = in.take(count * stride);
+                for (uint64_t j = 0; j < count; ++j) {
+                    Entity entity;
+                    std::memcpy(&entity, entities + j * sizeof(Entity), sizeof(Entity));
+                    uint32_t slot = ecs::entity::index(entity);
+                    if (slot >= restored_generations.size() || free_slot[slot] || seen_by[slot] == i + 1
+                        || restored_generations[slot] != ecs::entity::generation(entity))
+                        throw std::runtime_error("Corrupted registry snapshot");
+                    seen_by[slot] = i + 1;
+                }
+            }
+
+            generations = std::move(restored_generations);
+            free_indices = std::move(restored_free);
+            for (auto& pool : pools) {
+                if (pool && pool->snapshot_key() != 0) {
+                    snap::Reader empty(bytes, 0);
+                    pool->load(empty, 0);
+                }
+            }
+            for (const Record& record : records) {
+                snap::Reader data(bytes + record.offset, size - record.offset);
+                record.pool->load(data, record.count);
+            }
+            prune_and_rebuild_signatures();
+            for (auto& group : groups)
+                group->refresh();
+            for (auto& observer : observers_)
+                refill(*observer);
+            // Les liens ne font pas partie du snapshot : seuls ceux entre entités vivantes restent
+            hierarchy_.retain([this](Entity entity) { return is_alive(entity); });
+        }
+
+        void load_snapshot(const std::vector<uint8_t>& blob)
+        {
+            load_snapshot(blob.data(), blob.size());
+        }
+
+        /**
+         * @brief Choose how run_systems executes the systems
+         *
+         * Serial (default) runs them in registration order. Parallel groups
+         * non-conflicting systems (ISystem::declare_access) into stages run
+         * on worker threads; each system then records into its own
+         * commands() buffer, flushed in registration order after its stage.
+         */
+        void set_execution_mode(ecs::ExecutionMode mode, size_t workers = std::thread::hardware_concurrency())
+        {
+            execution_mode_ = mode;
+            if (mode == ecs::ExecutionMode::Parallel) {
+                // Le thread appelant participe aussi à l'exécution
+                scheduler_ = std::make_unique<ecs::SystemScheduler>(workers > 0 ? workers - 1 : 0);
+                schedule_dirty_ = true;
+            } else {
+                scheduler_.reset();
+            }
+        }
+
+        ecs::ExecutionMode get_execution_mode() const
+        {
+            return execution_mode_;
+        }
+
+        /**
+         * @brief Choose the component storage layout (see ecs::StorageBackend)
+         *
+         * Can be switched at any time: the archetype table is built from the
+         * current signatures, or dropped. Entities, components, groups and
+         * every registry API keep working the same in both modes; only the
+         * order of the dense pools, hence of views, differs.
+         */
+        void set_storage_backend(ecs::StorageBackend backend)
+        {
+            if (backend == ecs::StorageBackend::SparseSet) {
+                archetypes_.reset();
+                return;
+            }
+            if (archetypes_)
+                return;
+            archetypes_ = std::make_unique<ecs::ArchetypeIndex>(pools);
+            archetypes_->rebuild(signatures);
+        }
+
+        ecs::StorageBackend get_storage_backend() const
+        {
+            return archetypes_ ? ecs::StorageBackend::Archetype : ecs::StorageBackend::SparseSet;
+        }
+
+        /**
+         * @brief Archetype table, nullptr with the SparseSet backend
+         */
+        const ecs::ArchetypeIndex* archetypes() const
+        {
+            return archetypes_.get();
         }
 
         void run_systems(float dt)
         {
-            for (auto& system : systems)
-                system->update(*this, dt);
+            if (execution_mode_ == ecs::ExecutionMode::Parallel) {
+                run_systems_parallel(dt);
+                return;
+            }
+            for (SystemSlot& slot : systems) {
+                if (!slot.enabled)
+                    continue;
+                update_system(slot, dt);
+                // Point de synchronisation : modifications différées du système
+                flush_commands();
+            }
+        }
+
+        /**
+         * @brief Record the wall time of every system update (on by default)
+         *
+         * Two clock reads per system per tick; turning it off keeps the
+         * recorded histograms.
+         */
+        void set_profiling(bool enabled)
+        {
+            profiling_ = enabled;
+        }
+
+        bool is_profiling() const
+        {
+            return profiling_;
+        }
+
+        /**
+         * @brief Per-system cost since the last reset, in registration order
+         *
+         * Not synchronised with run_systems: query it between ticks, from
+         * the thread that runs them.
+         */
+        std::vector<ecs::SystemProfile> system_profile() const
+        {
+            std::vector<ecs::SystemProfile> profile;
+
+            profile.reserve(systems.size());
+            for (const SystemSlot& slot : systems) {
+                const ecs::TickHistogram& timings = slot.timings;
+                ecs::SystemProfile entry;
+
+                entry.name = slot.name;
+                entry.enabled = slot.enabled;
+                entry.samples = timings.samples();
+                entry.total_ms = static_cast<double>(timings.total_ns()) / 1e6;
+                if (entry.samples > 0)
+                    entry.mean_us = static_cast<double>(timings.total_ns()) / 1e3 / static_cast<double>(entry.samples);
+                entry.p50_us = static_cast<double>(timings.percentile(0.50)) / 1e3;
+                entry.p95_us = static_cast<double>(timings.percentile(0.95)) / 1e3;
+                entry.p99_us = static_cast<double>(timings.percentile(0.99)) / 1e3;
+                entry.max_us = static_cast<double>(timings.max_ns()) / 1e3;
+                entry.entities = slot.entities;
+                profile.push_back(std::move(entry));
+            }
+            return profile;
         }
 
+        void reset_system_profile()
+        {
+            for (SystemSlot& slot : systems) {
+                slot.timings.reset();
+                slot.entities = 0;
+            }
+        }
+
+        /**
+         * @brief Registered system of exactly this type, nullptr if none
+         *
+         * One indexed access (ecs::SystemFamily); the pointer stays valid
+         * until the system is removed.
+         */
         template <typename System>
-        System& get_system()
+        System* find_system()
         {
             static_assert(std::is_base_of<ISystem, System>::value, "System must inherit from ISystem");
-            for (auto& sys : systems) {
-                if (auto* ptr = dynamic_cast<System*>(sys.get())) {
-                    return *ptr;
-                }
-            }
+            size_t family = ecs::SystemFamily::id<System>();
+
+            if (family >= system_index_.size())
+                return nullptr;
+            return static_cast<System*>(system_index_[family]);
+        }
+
+        template <typename System>
+        System& get_system()
+        {
+            if (System* system = find_system<System>())
+                return *system;
             throw std::runtime_error("System not found in registry");
         }
 
@@ -124,14 +1262,117 @@ class Registry {
         bool has_system() const
         {
             static_assert(std::is_base_of<ISystem, System>::value, "System must inherit from ISystem");
-            for (const auto& sys : systems) {
-                if (dynamic_cast<const System*>(sys.get())) {
-                    return true;
-                }
-            }
-            return false;
+            size_t family = ecs::SystemFamily::id<System>();
+
+            return family < system_index_.size() && system_index_[family] != nullptr;
         }
 
 };
 
+// Définitions du CommandBuffer et des prefabs qui ont besoin du Registry complet
+
+template <typename Component>
+void ecs::PrefabComponent<Component>::instantiate(Registry& registry, const Entity* entities, size_t count) const
+{
+    registry.add_components(entities, count, value);
+}
+
+template <typename... Components, typename Init>
+void ecs::CommandBuffer::instantiate(const Prefab& prefab, size_t count, Init&& init)
+{
+    uint32_t first = pending_spawns_;
+
+    pending_spawns_ += static_cast<uint32_t>(count);
+    commands_.push_back({Kind::Instantiate, 0, ecs::entity::make(first, PENDING_GENERATION),
+        static_cast<uint32_t>(batches_.size())});
+    batches_.push_back({&prefab, static_cast<uint32_t>(count),
+        [init = std::forward<Init>(init)](Registry& registry, const Prefab& target, const Entity* entities, size_t size) mutable {
+            registry.instantiate_at<Components...>(target, entities, size, init);
+        }});
+}
+
+template <typename Component>
+void ecs::CommandQueue<Component>::reserve(Registry& registry)
+{
+    if (SparseSet<Component>* set = registry.find_components<Component>())
+        set->reserve(set->size() + values.size());
+}
+
+template <typename Component>
+void ecs::CommandQueue<Component>::add(Registry& registry, Entity entity, uint32_t payload)
+{
+    // Sorti du buffer avant l'ajout : un ajout imbriqué peut réallouer values
+    Component component = std::move(values[payload]);
+    registry.add_component(entity, std::move(component));
+}
+
+template <typename Component>
+void ecs::CommandQueue<Component>::remove(Registry& registry, Entity entity)
+{
+    registry.remove_component<Component>(entity);
+}
+
+inline Entity ecs::CommandBuffer::resolve(Registry& registry, Entity entity)
+{
+    if (!is_pending(entity))
+        return entity;
+    uint32_t index = ecs::entity::index(entity);
+    if (index >= spawned_.size())
+        registry.spawn_entities(index + 1 - spawned_.size(), spawned_);
+    return spawned_[index];
+}
+
+inline void ecs::CommandBuffer::flush(Registry& registry)
+{
+    registry.spawn_entities(pending_spawns_, spawned_);
+    for (auto& queue : queues_)
+        if (queue)
+            queue->reserve(registry);
+
+    // Indexé : une commande enregistrée pendant le flush est appliquée aussi
+    for (size_t i = 0; i < commands_.size(); i++) {
+        Command command = commands_[i];
+        Entity entity = resolve(registry, command.entity);
+
+        switch (command.kind) {
+            // Entité tuée plus tôt (ce buffer ou un précédent) : la commande est caduque
+            case Kind::Add:
+                if (registry.is_alive(entity))
+                    queues_[command.family]->add(registry, entity, command.payload);
+                break;
+            case Kind::Remove:
+                if (registry.is_alive(entity))
+                    queues_[command.family]->remove(registry, entity);
+                break;
+            case Kind::Kill:
+                registry.kill_entity(entity);
+                break;
+            case Kind::Instantiate: {
+                // Sortis du buffer : l'initialiseur peut enregistrer d'autres commandes
+                Batch batch = std::move(batches_[command.payload]);
+                uint32_t first = ecs::entity::index(command.entity);
+
+                if (batch.count > 0)
+                    resolve(registry, ecs::entity::make(first + batch.count - 1, PENDING_GENERATION));
+                batch_entities_.clear();
+                for (uint32_t j = first; j < first + batch.count; j++)
+                    if (registry.is_alive(spawned_[j]))
+                        batch_entities_.push_back(spawned_[j]);
+                batch.stamp(registry, *batch.prefab, batch_entities_.data(), batch_entities_.size());
+                break;
+            }
+        }
+    }
+    if (spawned_.size() < pending_spawns_)
+        registry.spawn_entities(pending_spawns_ - spawned_.size(), spawned_);
+
+    commands_.clear();
+    batches_.clear();
+    for (auto& queue : queues_)
+        if (queue)
+            queue->clear();
+    pending_spawns_ = 0;
+    spawned_.clear();
+}
+
 #endif /* !REGISTRY_HPP_ */
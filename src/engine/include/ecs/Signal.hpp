@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** Signal
+*/
+
+#ifndef SIGNAL_HPP_
+#define SIGNAL_HPP_
+#include "EntityHandle.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @brief Listeners of a structural change of a component pool
+ *
+ * Each pool has two of them (Registry::on_construct / on_destroy), emitted
+ * by the Registry with the entity concerned: on_construct right after the
+ * component was added, on_destroy right before it is removed (the component
+ * is still readable). Replacing an existing component emits nothing.
+ *
+ * A listener may read the registry, but must not add or remove components
+ * itself (record them in Registry::commands()), nor connect or disconnect
+ * listeners of the signal being emitted.
+ */
+class Signal {
+    public:
+        using Listener = std::function<void(Entity)>;
+
+        // Renvoie l'identifiant de la connexion, à passer à disconnect()
+        size_t connect(Listener listener)
+        {
+            listeners_.push_back({next_id_, std::move(listener)});
+            return next_id_++;
+        }
+
+        void disconnect(size_t id)
+        {
+            listeners_.erase(std::remove_if(listeners_.begin(), listeners_.end(),
+                [id](const Connection& connection) { return connection.id == id; }), listeners_.end());
+        }
+
+        void emit(Entity entity) const
+        {
+            for (const Connection& connection : listeners_)
+                connection.listener(entity);
+        }
+
+        bool empty() const
+        {
+            return listeners_.empty();
+        }
+
+        size_t size() const
+        {
+            return listeners_.size();
+        }
+
+    private:
+        struct Connection {
+            size_t id;
+            Listener listener;
+        };
+
+        std::vector<Connection> listeners_;
+        size_t next_id_ = 0;
+};
+
+}
+
+#endif /* !SIGNAL_HPP_ */
@@ -0,0 +1,110 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** Snapshot
+*/
+
+#ifndef SNAPSHOT_HPP_
+#define SNAPSHOT_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @brief Opt-in trait for Registry::save_snapshot / load_snapshot
+ *
+ * Components are left out of snapshots by default. A component opts in with
+ * ECS_SNAPSHOT_COMPONENT(Type) at global scope, next to its definition. It
+ * must be trivially copyable and default constructible: its pool is written
+ * as one binary copy of the dense arrays. The key is a hash of the
+ * spelled type name, so it stays stable across builds and processes (crash
+ * checkpoints, replays), unlike ecs::ComponentFamily ids.
+ */
+template <typename Component>
+struct snapshot_traits {
+    static constexpr bool enabled = false;
+};
+
+namespace snapshot {
+
+// Format du blob (endianness native, relu par le même binaire)
+static constexpr uint32_t MAGIC = 0x53475231;
+static constexpr uint32_t VERSION = 1;
+
+constexpr uint32_t fnv1a(const char* str)
+{
+    uint32_t hash = 2166136261u;
+
+    for (; *str; ++str) {
+        hash ^= static_cast<uint8_t>(*str);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+inline void write_bytes(std::vector<uint8_t>& out, const void* src, size_t size)
+{
+    if (size == 0)
+        return;
+    size_t offset = out.size();
+    out.resize(offset + size);
+    std::memcpy(out.data() + offset, src, size);
+}
+
+template <typename T>
+void write(std::vector<uint8_t>& out, const T& value)
+{
+    write_bytes(out, &value, sizeof(T));
+}
+
+/**
+ * @brief Bounds-checked cursor over a snapshot blob (std::runtime_error if truncated)
+ */
+class Reader {
+    public:
+        Reader(const uint8_t* data, size_t size) : cursor_(data), end_(data + size) {}
+
+        const uint8_t* take(size_t size)
+        {
+            if (size > remaining())
+                throw std::runtime_error("Truncated registry snapshot");
+            const uint8_t* bytes = cursor_;
+            cursor_ += size;
+            return bytes;
+        }
+
+        template <typename T>
+        T read()
+        {
+            T value;
+            std::memcpy(&value, take(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+        size_t remaining() const
+        {
+            return static_cast<size_t>(end_ - cursor_);
+        }
+
+    private:
+        const uint8_t* cursor_;
+        const uint8_t* end_;
+};
+
+}
+
+}
+
+#define ECS_SNAPSHOT_COMPONENT(Type)                                  \
+    template <>                                                       \
+    struct ecs::snapshot_traits<Type> {                               \
+        static constexpr bool enabled = true;                         \
+        static constexpr uint32_t key = ecs::snapshot::fnv1a(#Type);  \
+    }
+
+#endif /* !SNAPSHOT_HPP_ */
@@ -7,30 +7,117 @@
 
 #ifndef SPARSESET_HPP_
 #define SPARSESET_HPP_
+#include <algorithm>
 #include <vector>
+#include <memory_resource>
 #include <iostream>
 #include <optional>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+#include "EntityHandle.hpp"
 
-using Entity = size_t;
+namespace ecs {
+
+// Tri d'un pool (Registry::sort) : complet, ou par insertion pour un pool presque trié
+enum class SortMode {
+    Full,
+    Incremental
+};
+
+}
 
 template <typename Component>
 class SparseSet {
+        public:
+            // Nombre de slots par page du sparse (4 Kio de uint32_t)
+            static constexpr size_t PAGE_SIZE = 1024;
+            // Valeur d'un slot sans composant
+            static constexpr uint32_t TOMBSTONE = UINT32_MAX;
+            // Composant vide (tag : NoFriction, ToDestroy...) : aucun stockage par
+            // entité, seuls l'index sparse/dense et les ticks existent
+            static constexpr bool IS_TAG = std::is_empty_v<Component>;
+
         private:
-            std::vector<std::optional<size_t>> sparse;
-            std::vector<Entity> dense;
-            std::vector<Component> data;
+            // Sparse paginé : une page n'est allouée que si un slot qu'elle couvre
+            // a été utilisé, une page vide (non allouée) vaut TOMBSTONE partout
+            // Tous les tableaux viennent de la même ressource mémoire (arène de la
+            // session via Registry, tas global par défaut)
+            std::pmr::vector<std::pmr::vector<uint32_t>> sparse_pages;
+            std::pmr::vector<Entity> dense;
+            struct NoStorage {};
+            [[no_unique_address]] std::conditional_t<IS_TAG, NoStorage, std::pmr::vector<Component>> data;
+            // Tick de dernière modification de chaque composant, aligné sur data
+            std::pmr::vector<uint32_t> ticks;
+            // Horloge de changement (celle du Registry), nullptr pour un set isolé
+            const uint32_t* clock = nullptr;
+
+            // Construit sur place (pas d'affectation : un pmr::vector garde sa ressource)
+            static auto make_storage(std::pmr::memory_resource* resource)
+            {
+                if constexpr (IS_TAG) {
+                    (void)resource;
+                    return NoStorage{};
+                } else {
+                    return std::pmr::vector<Component>(resource);
+                }
+            }
+
+            uint32_t now() const
+            {
+                return clock ? *clock : 1;
+            }
+
+            // Instance partagée rendue pour un tag (ne porte aucune donnée)
+            static Component& tag_instance()
+            {
+                static Component instance{};
+                return instance;
+            }
+
+            Component& value_at(size_t index)
+            {
+                if constexpr (IS_TAG) {
+                    return tag_instance();
+                } else {
+                    return data[index];
+                }
+            }
+
+            uint32_t sparse_at(uint32_t slot) const
+            {
+                size_t page = slot / PAGE_SIZE;
+
+                if (page >= sparse_pages.size() || sparse_pages[page].empty()) {
+                    return TOMBSTONE;
+                }
+                return sparse_pages[page][slot % PAGE_SIZE];
+            }
+
+            uint32_t& sparse_ref(uint32_t slot)
+            {
+                size_t page = slot / PAGE_SIZE;
+
+                if (page >= sparse_pages.size()) sparse_pages.resize(page + 1);
+                if (sparse_pages[page].empty()) sparse_pages[page].assign(PAGE_SIZE, TOMBSTONE);
+                return sparse_pages[page][slot % PAGE_SIZE];
+            }
+
         public:
             SparseSet() = default;
+            explicit SparseSet(std::pmr::memory_resource* resource)
+                : sparse_pages(resource), dense(resource), data(make_storage(resource)), ticks(resource) {}
             ~SparseSet() = default;
 
             
             Component& operator[](Entity entity_id)
             {
-                if (entity_id >= sparse.size() || !sparse[entity_id].has_value()) {
+                if (!has_entity(entity_id)) {
                     throw std::bad_optional_access();
                 }
-                size_t element = sparse[entity_id].value();
-                return data[element];
+                return value_at(sparse_at(ecs::entity::index(entity_id)));
             }
 
 
@@ -38,15 +125,18 @@ class SparseSet {
 
             // 1. Retourne la taille de l'itération (nombre de composants actifs)
             size_t size() const {
-                return data.size();
+                return dense.size();
             }
 
             // 2. Vérifie si l'entité possède ce composant
+            // Un handle périmé (même index, génération différente) est rejeté
             bool has_entity(Entity entity_id) const {
-                if (entity_id >= sparse.size()) {
+                uint32_t element = sparse_at(ecs::entity::index(entity_id));
+
+                if (element == TOMBSTONE) {
                     return false;
                 }
-                return sparse[entity_id].has_value();
+                return dense[element] == entity_id;
             }
 
             // 3. Obtient l'ID de l'entité à l'index d'itération (pour la boucle for)
@@ -59,10 +149,10 @@ class SparseSet {
 
             // 4. Obtient la donnée du composant à l'index d'itération (pour la boucle for)
             Component& get_data_at(size_t index) {
-                if (index >= data.size()) {
+                if (index >= dense.size()) {
                     throw std::out_of_range("Index out of bounds in SparseSet::get_data_at");
                 }
-                return data[index];
+                return value_at(index);
             }
             
             // 5. Equivalent de l'opérateur [] mais en fonction (utilisé par SystemMouvement)
@@ -70,30 +160,292 @@ class SparseSet {
                 return (*this)[entity_id];
             }
 
+            // 6. Pointeur vers le composant, nullptr si absent (une seule recherche,
+            // sans exception, utilisé par les vues multi-composants)
+            Component* find(Entity entity_id) {
+                uint32_t element = sparse_at(ecs::entity::index(entity_id));
+
+                if (element == TOMBSTONE || dense[element] != entity_id) {
+                    return nullptr;
+                }
+                return &value_at(element);
+            }
+
+            // 7. Liste dense des entités, dans l'ordre d'itération
+            const std::pmr::vector<Entity>& entities() const {
+                return dense;
+            }
+
+            // 8. Mémoire occupée par l'index sparse (pages allouées uniquement)
+            size_t sparse_memory_usage() const {
+                size_t bytes = sparse_pages.capacity() * sizeof(std::pmr::vector<uint32_t>);
+
+                for (const auto& page : sparse_pages)
+                    bytes += page.capacity() * sizeof(uint32_t);
+                return bytes;
+            }
+
+            // 9. Position de l'entité dans le tableau dense (TOMBSTONE si absente)
+            uint32_t index_of(Entity entity_id) const {
+                return has_entity(entity_id) ? sparse_at(ecs::entity::index(entity_id)) : TOMBSTONE;
+            }
+
+            // 10. Echange deux positions du tableau dense (entités, données et sparse),
+            // utilisé par les groupes pour garder plusieurs pools alignés
+            void swap_at(size_t lhs, size_t rhs) {
+                if (lhs == rhs) {return;}
+                std::swap(dense[lhs], dense[rhs]);
+                if constexpr (!IS_TAG) {
+                    std::swap(data[lhs], data[rhs]);
+                }
+                std::swap(ticks[lhs], ticks[rhs]);
+                sparse_ref(ecs::entity::index(dense[lhs])) = static_cast<uint32_t>(lhs);
+                sparse_ref(ecs::entity::index(dense[rhs])) = static_cast<uint32_t>(rhs);
+            }
+
+            // 11. Accès direct aux données, dans l'ordre de entities() (nullptr pour un tag)
+            Component* raw() {
+                if constexpr (IS_TAG) {
+                    return nullptr;
+                } else {
+                    return data.data();
+                }
+            }
+
+            // 12. Réserve la place de capacity composants (ajouts en masse).
+            // La capacité au moins double quand elle doit grandir : des réservations
+            // répétées de size() + n ne réallouent pas à chaque lot
+            void reserve(size_t capacity) {
+                if (capacity <= dense.capacity()) {return;}
+                capacity = std::max(capacity, dense.capacity() * 2);
+                dense.reserve(capacity);
+                if constexpr (!IS_TAG) {
+                    data.reserve(capacity);
+                }
+                ticks.reserve(capacity);
+            }
+
+            // 13. Branche le set sur une horloge de changement (Registry::change_tick)
+            void set_clock(const uint32_t* change_clock) {
+                clock = change_clock;
+            }
+
+            // 14. Modifie le composant via fn(component) et le marque comme changé.
+            // Un accès mutable classique (operator[], find, raw) ne marque rien :
+            // les lectures passent elles aussi par des références non const
+            template <typename Func>
+            Component& patch(Entity entity_id, Func&& fn) {
+                uint32_t element = index_of(entity_id);
+
+                if (element == TOMBSTONE) {
+                    throw std::bad_optional_access();
+                }
+                Component& component = value_at(element);
+
+                fn(component);
+                ticks[element] = now();
+                return component;
+            }
+
+            // 15. Marque le composant comme changé sans le modifier (écriture déjà faite)
+            void touch(Entity entity_id) {
+                uint32_t element = index_of(entity_id);
+
+                if (element != TOMBSTONE) {
+                    ticks[element] = now();
+                }
+            }
+
+            // 16. Tick de la dernière modification (0 si l'entité n'a pas le composant)
+            uint32_t changed_tick(Entity entity_id) const {
+                uint32_t element = index_of(entity_id);
+
+                return element == TOMBSTONE ? 0 : ticks[element];
+            }
+
+            // 17. Parcourt les composants ajoutés ou marqués après le tick donné :
+            // fn(Entity, Component&), dans l'ordre de entities()
+            template <typename Func>
+            void changed_since(uint32_t tick, Func&& fn) {
+                for (size_t i = 0; i < dense.size(); ++i) {
+                    if (ticks[i] > tick) {
+                        fn(dense[i], value_at(i));
+                    }
+                }
+            }
+
+            // 18. Donnée à l'index d'itération sans contrôle de bornes (boucles des groupes)
+            Component& unchecked_at(size_t index) {
+                return value_at(index);
+            }
+
+            // 19. Remplace tout le contenu par count entités et leurs composants, copiés
+            // octet par octet (restauration d'un snapshot) ; l'index sparse est
+            // reconstruit et tous les composants sont marqués comme changés
+            void assign_bytes(const void* entities, const void* components, size_t count) {
+                static_assert(std::is_trivially_copyable_v<Component>, "assign_bytes needs a trivially copyable component");
+
+                for (Entity entity_id : dense) {
+                    sparse_ref(ecs::entity::index(entity_id)) = TOMBSTONE;
+                }
+                dense.resize(count);
+                if (count > 0) {
+                    std::memcpy(dense.data(), entities, count * sizeof(Entity));
+                }
+                if constexpr (!IS_TAG) {
+                    data.resize(count);
+                    if (count > 0) {
+                        std::memcpy(data.data(), components, count * sizeof(Component));
+                    }
+                }
+                ticks.assign(count, now());
+                for (size_t i = 0; i < count; ++i) {
+                    sparse_ref(ecs::entity::index(dense[i])) = static_cast<uint32_t>(i);
+                }
+            }
+
+            // 20. Place les entités de order en tête du tableau dense, dans cet ordre
+            // (celles absentes du set sont ignorées, les autres suivent)
+            void arrange(const std::vector<Entity>& order) {
+                size_t position = 0;
+
+                for (Entity entity_id : order) {
+                    // Déjà en place (cas courant) : pas de recherche sparse
+                    if (position < dense.size() && dense[position] == entity_id) {
+                        position++;
+                        continue;
+                    }
+                    uint32_t element = index_of(entity_id);
+
+                    if (element == TOMBSTONE) {continue;}
+                    swap_at(position++, element);
+                }
+            }
+
+            // 21. Trie le tableau dense en place selon compare(const Component&, const Component&),
+            // tri stable ; l'ordre est gardé jusqu'au prochain ajout ou retrait
+            template <typename Compare>
+            void sort(Compare compare) {
+                static_assert(!IS_TAG, "A tag pool has no value to sort on");
+                std::vector<uint32_t> order(dense.size());
+                std::vector<Entity> sorted(dense.size());
+
+                for (size_t i = 0; i < order.size(); ++i) {
+                    order[i] = static_cast<uint32_t>(i);
+                }
+                std::stable_sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs) {
+                    return compare(data[lhs], data[rhs]);
+                });
+                for (size_t i = 0; i < order.size(); ++i) {
+                    sorted[i] = dense[order[i]];
+                }
+                arrange(sorted);
+            }
+
+            // 22. Même tri par insertion, sans allocation : linéaire sur un tableau presque
+            // trié (quelques ajouts ou retraits depuis le tri précédent). Au-delà de
+            // quelques déplacements par élément, termine avec sort()
+            template <typename Compare>
+            void sort_incremental(Compare compare) {
+                static_assert(!IS_TAG, "A tag pool has no value to sort on");
+                size_t budget = 8 * dense.size() + 64;
+
+                for (size_t i = 1; i < dense.size(); ++i) {
+                    for (size_t j = i; j > 0 && compare(data[j], data[j - 1]); --j) {
+                        if (budget-- == 0) {
+                            sort(compare);
+                            return;
+                        }
+                        swap_at(j, j - 1);
+                    }
+                }
+            }
+
             // Méthodes
-            void erase(size_t index)
+            void erase(Entity entity_id)
             {
-                if (index >= sparse.size() || !sparse[index].has_value()) {return;}
+                if (!has_entity(entity_id)) {return;}
 
-                size_t delete_id = sparse[index].value();
-                size_t last_entity_id = dense[dense.size() - 1];
+                uint32_t slot = ecs::entity::index(entity_id);
+                uint32_t delete_id = sparse_at(slot);
+                Entity last_entity_id = dense[dense.size() - 1];
 
                 dense[delete_id] = last_entity_id;
                 dense.pop_back();
 
-                data[delete_id] = data[data.size() - 1];
-                data.pop_back();
+                // Swap-remove par déplacement : aucune copie des membres alloués
+                if (delete_id != ticks.size() - 1) {
+                    if constexpr (!IS_TAG) {
+                        data[delete_id] = std::move(data.back());
+                    }
+                    ticks[delete_id] = ticks.back();
+                }
+                if constexpr (!IS_TAG) {
+                    data.pop_back();
+                }
+                ticks.pop_back();
 
-                sparse[last_entity_id] = delete_id;
-                sparse[index].reset();
+                sparse_ref(ecs::entity::index(last_entity_id)) = delete_id;
+                sparse_ref(slot) = TOMBSTONE;
             }
 
-            void insert_at(size_t index, const Component& component)
+            // Le sparse est indexé par le slot de l'entité (sans génération) et
+            // paginé : seules les pages effectivement touchées sont allouées
+            void insert_at(Entity entity_id, const Component& component)
             {
-                if (index >= sparse.size()) sparse.resize(index + 1);
-                dense.push_back(index);
-                data.push_back(component);
-                sparse[index] = dense.size() - 1;
+                emplace(entity_id, component);
+            }
+
+            // Version par déplacement : le composant (et ses membres alloués) est
+            // transféré dans le pool sans copie
+            void insert_at(Entity entity_id, Component&& component)
+            {
+                emplace(entity_id, std::move(component));
+            }
+
+            // Construit le composant en place à partir de ses arguments (constructeur
+            // ou initialisation d'agrégat), ou remplace celui déjà présent.
+            // Un slot occupé par un autre handle (autre génération) n'est jamais écrasé
+            template <typename... Args>
+            Component& emplace(Entity entity_id, Args&&... args)
+            {
+                uint32_t& element = sparse_ref(ecs::entity::index(entity_id));
+
+                if (element != TOMBSTONE) {
+                    if (dense[element] != entity_id)
+                        throw std::logic_error("SparseSet slot is owned by another entity handle");
+                    ticks[element] = now();
+                    if constexpr (IS_TAG) {
+                        // Rien à remplacer : les arguments d'un tag sont ignorés
+                    } else if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::decay_t<Args>, Component> && ...)) {
+                        data[element] = (std::forward<Args>(args), ...);
+                    } else {
+                        data[element] = make(std::forward<Args>(args)...);
+                    }
+                    return value_at(element);
+                }
+                dense.push_back(entity_id);
+                if constexpr (IS_TAG) {
+                    // Pas de donnée à construire pour un tag
+                } else if constexpr (std::is_constructible_v<Component, Args&&...>) {
+                    data.emplace_back(std::forward<Args>(args)...);
+                } else {
+                    data.push_back(Component{std::forward<Args>(args)...});
+                }
+                ticks.push_back(now());
+                element = static_cast<uint32_t>(dense.size() - 1);
+                return value_at(element);
+            }
+
+        private:
+            template <typename... Args>
+            static Component make(Args&&... args)
+            {
+                if constexpr (std::is_constructible_v<Component, Args&&...>) {
+                    return Component(std::forward<Args>(args)...);
+                } else {
+                    return Component{std::forward<Args>(args)...};
+                }
             }
 };
 
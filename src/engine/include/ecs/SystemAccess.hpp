@@ -0,0 +1,96 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** SystemAccess
+*/
+
+#ifndef SYSTEMACCESS_HPP_
+#define SYSTEMACCESS_HPP_
+#include "ComponentMask.hpp"
+#include "ComponentPool.hpp"
+#include <stdexcept>
+
+namespace ecs {
+
+/**
+ * @brief Components a system reads and writes during update(), used by the parallel scheduler
+ *
+ * Two systems may run concurrently when neither writes a component the
+ * other reads or writes. Components added or removed through the
+ * CommandBuffer count as writes, and so do the components of entities
+ * killed through it. A system that changes the registry structure directly,
+ * publishes events synchronously, or touches undeclared state must be
+ * exclusive (the default of ISystem::declare_access).
+ */
+class SystemAccess {
+    public:
+        template <typename... Component>
+        SystemAccess& reads()
+        {
+            (reads_.set(family_of<Component>()), ...);
+            return *this;
+        }
+
+        template <typename... Component>
+        SystemAccess& writes()
+        {
+            (writes_.set(family_of<Component>()), ...);
+            return *this;
+        }
+
+        SystemAccess& exclusive()
+        {
+            exclusive_ = true;
+            return *this;
+        }
+
+        bool is_exclusive() const
+        {
+            return exclusive_;
+        }
+
+        // Système déclaré sans aucun accès (update() vide, logique sur événements)
+        bool is_empty() const
+        {
+            return !exclusive_ && reads_.none() && writes_.none();
+        }
+
+        // Appelle func(family) pour chaque composant lu ou écrit (un écrit lu est vu deux fois)
+        template <typename Func>
+        void for_each_component(Func&& func) const
+        {
+            reads_.for_each(func);
+            writes_.for_each(func);
+        }
+
+        bool conflicts_with(const SystemAccess& other) const
+        {
+            if (is_empty() || other.is_empty())
+                return false;
+            if (exclusive_ || other.exclusive_)
+                return true;
+            return writes_.intersects(other.reads_) || writes_.intersects(other.writes_)
+                || other.writes_.intersects(reads_);
+        }
+
+    private:
+        // Même borne que Registry::register_component : le masque n'a que MAX_COMPONENTS bits
+        template <typename Component>
+        static size_t family_of()
+        {
+            size_t family = ComponentFamily::id<Component>();
+
+            if (family >= MAX_COMPONENTS)
+                throw std::length_error("Too many component types (raise ecs::MAX_COMPONENTS)");
+            return family;
+        }
+
+        ComponentMask reads_;
+        ComponentMask writes_;
+        bool exclusive_ = false;
+};
+
+}
+
+#endif /* !SYSTEMACCESS_HPP_ */
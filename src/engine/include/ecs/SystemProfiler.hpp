@@ -0,0 +1,151 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** SystemProfiler
+*/
+
+#ifndef SYSTEMPROFILER_HPP_
+#define SYSTEMPROFILER_HPP_
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#if defined(__GNUG__)
+    #include <cxxabi.h>
+#endif
+
+namespace ecs {
+
+/**
+ * @brief Fixed-size log-linear histogram of durations in nanoseconds
+ *
+ * Four buckets per power of two (relative error under 25%, values reported
+ * at the bucket middle), up to about 18 minutes. Recording is a few integer
+ * operations and never allocates, so it can run for every system on every
+ * tick.
+ */
+class TickHistogram {
+    public:
+        static constexpr size_t SUB_BUCKETS = 4;
+        static constexpr size_t BUCKETS = 160;
+
+        void record(uint64_t ns)
+        {
+            counts_[bucket_of(ns)]++;
+            samples_++;
+            total_ns_ += ns;
+            if (ns > max_ns_)
+                max_ns_ = ns;
+        }
+
+        void reset()
+        {
+            counts_.fill(0);
+            samples_ = 0;
+            total_ns_ = 0;
+            max_ns_ = 0;
+        }
+
+        // Durée sous laquelle tombent q (0..1) des échantillons
+        uint64_t percentile(double q) const
+        {
+            if (samples_ == 0)
+                return 0;
+            uint64_t target = static_cast<uint64_t>(q * static_cast<double>(samples_) + 0.999999);
+            uint64_t seen = 0;
+
+            if (target == 0)
+                target = 1;
+            for (size_t i = 0; i < BUCKETS; i++) {
+                seen += counts_[i];
+                if (seen >= target)
+                    return middle_of(i) < max_ns_ ? middle_of(i) : max_ns_;
+            }
+            return max_ns_;
+        }
+
+        uint64_t samples() const
+        {
+            return samples_;
+        }
+
+        uint64_t total_ns() const
+        {
+            return total_ns_;
+        }
+
+        uint64_t max_ns() const
+        {
+            return max_ns_;
+        }
+
+    private:
+        std::array<uint32_t, BUCKETS> counts_{};
+        uint64_t samples_ = 0;
+        uint64_t total_ns_ = 0;
+        uint64_t max_ns_ = 0;
+
+        static size_t bucket_of(uint64_t ns)
+        {
+            if (ns < SUB_BUCKETS)
+                return static_cast<size_t>(ns);
+            size_t power = static_cast<size_t>(std::bit_width(ns)) - 1;
+            size_t index = SUB_BUCKETS * (power - 1) + ((ns >> (power - 2)) & (SUB_BUCKETS - 1));
+            return index < BUCKETS ? index : BUCKETS - 1;
+        }
+
+        static uint64_t middle_of(size_t index)
+        {
+            if (index < SUB_BUCKETS)
+                return index;
+            size_t power = index / SUB_BUCKETS + 1;
+            uint64_t width = uint64_t{1} << (power - 2);
+            uint64_t lower = (SUB_BUCKETS + index % SUB_BUCKETS) * width;
+            return lower + width / 2;
+        }
+};
+
+/**
+ * @brief Cost of one system over the ticks recorded since the last reset
+ *
+ * Durations are wall time of update() in microseconds. `entities` is the
+ * size of the smallest pool among the components the system declared
+ * (ISystem::declare_access), i.e. what a view over them iterates, at its
+ * last run; 0 for exclusive systems.
+ */
+struct SystemProfile {
+    std::string name;
+    bool enabled = true;
+    uint64_t samples = 0;
+    double total_ms = 0.0;
+    double mean_us = 0.0;
+    double p50_us = 0.0;
+    double p95_us = 0.0;
+    double p99_us = 0.0;
+    double max_us = 0.0;
+    size_t entities = 0;
+};
+
+// Nom lisible d'un type (typeid(T).name() démanglé sous GCC/Clang)
+inline std::string readable_type_name(const char* mangled)
+{
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+
+    if (status == 0 && demangled) {
+        std::string name(demangled);
+        std::free(demangled);
+        return name;
+    }
+#endif
+    return mangled;
+}
+
+}
+
+#endif /* !SYSTEMPROFILER_HPP_ */
@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** SystemScheduler
+*/
+
+#ifndef SYSTEMSCHEDULER_HPP_
+#define SYSTEMSCHEDULER_HPP_
+#include "SystemAccess.hpp"
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ecs {
+
+enum class ExecutionMode {
+    Serial,     ///< Registration order on the calling thread (deterministic reference)
+    Parallel    ///< Non-conflicting systems run concurrently on the scheduler workers
+};
+
+/**
+ * @brief Splits the systems into stages of non-conflicting systems and runs a stage on a worker pool
+ *
+ * Stages are built greedily in registration order: a system joins the
+ * current stage unless it conflicts (SystemAccess::conflicts_with) with a
+ * system already in it, in which case it opens the next stage. Every
+ * conflicting pair therefore runs in registration order, and the Registry
+ * flushes the per-system command buffers of a stage in registration order,
+ * which gives the same end-of-tick state as the serial mode.
+ *
+ * The calling thread takes part in the work, so a scheduler with 0 workers
+ * runs everything inline.
+ */
+class SystemScheduler {
+    public:
+        explicit SystemScheduler(size_t workers);
+        ~SystemScheduler();
+
+        SystemScheduler(const SystemScheduler&) = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+        void build(const std::vector<SystemAccess>& accesses);
+
+        const std::vector<std::vector<size_t>>& stages() const
+        {
+            return stages_;
+        }
+
+        size_t worker_count() const
+        {
+            return workers_.size();
+        }
+
+        /**
+         * @brief Run task(index) for every index of the stage, then wait for all of them
+         *
+         * The first exception thrown by a task is rethrown on the calling thread.
+         */
+        void run_stage(const std::vector<size_t>& stage, const std::function<void(size_t)>& task);
+
+    private:
+        void worker_loop();
+        // Exécute des tâches de l'étape courante tant qu'il en reste (verrou tenu en entrée)
+        void drain(std::unique_lock<std::mutex>& lock);
+
+        std::vector<std::thread> workers_;
+        std::vector<std::vector<size_t>> stages_;
+
+        std::mutex mutex_;
+        std::condition_variable work_cv_;
+        std::condition_variable done_cv_;
+        const std::vector<size_t>* stage_ = nullptr;
+        const std::function<void(size_t)>* task_ = nullptr;
+        size_t next_ = 0;
+        size_t remaining_ = 0;
+        std::exception_ptr error_;
+        bool shutdown_ = false;
+};
+
+}
+
+#endif /* !SYSTEMSCHEDULER_HPP_ */
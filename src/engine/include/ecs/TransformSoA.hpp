@@ -0,0 +1,132 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** TransformSoA
+*/
+
+#ifndef TRANSFORMSOA_HPP_
+#define TRANSFORMSOA_HPP_
+#include "CoreComponents.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @brief std::allocator replacement returning Alignment-aligned blocks
+ */
+template <typename T, size_t Alignment>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* ptr, size_t)
+    {
+        ::operator delete(ptr, std::align_val_t{Alignment});
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const
+    {
+        return true;
+    }
+};
+
+/**
+ * @brief Structure-of-arrays Position/Velocity storage for vectorized physics
+ *
+ * For transforms that stay in this layout across ticks: load() once, run
+ * the kernels every tick, store() only when the components must be read
+ * back. Copying an AoS group in and out on every tick costs more than the
+ * kernels save (bench_transform_soa), so PhysiqueSystem does not use it.
+ *
+ * x and y live in separate contiguous float arrays, 64-byte aligned and
+ * padded to a whole number of AVX registers, so the kernels below run
+ * without a scalar tail. Padding lanes are computed along and never
+ * written back.
+ *
+ * Per-entity parameters are arrays as well: the friction factor (1.0f for
+ * NoFriction entities) and a clamp mask (all bits set for Controllable
+ * entities, kept inside [0, width] x [0, height]).
+ *
+ * The kernels use AVX when the translation unit is built with it, SSE2
+ * otherwise (always available on x86-64), and plain loops elsewhere. Their
+ * results match the scalar PhysiqueSystem loop: same operations, same order.
+ */
+class TransformSoA {
+    public:
+        static constexpr size_t ALIGNMENT = 64;
+        // Nombre de flottants par registre AVX : granularité du remplissage
+        static constexpr size_t LANES = 8;
+
+        template <typename T>
+        using Array = std::vector<T, AlignedAllocator<T, ALIGNMENT>>;
+
+        /**
+         * @brief Resize for count entities, keeping the current contents
+         *
+         * Lanes past count are computed but never stored back. Friction and
+         * clamp must be set for every entity after a resize.
+         */
+        void resize(size_t count);
+
+        size_t size() const
+        {
+            return count_;
+        }
+
+        // Désentrelace count_ Position/Velocity (tableaux denses d'un groupe)
+        void load(const Position* positions, const Velocity* velocities);
+        void store(Position* positions, Velocity* velocities) const;
+
+        void set_friction(size_t index, float factor)
+        {
+            friction_[index] = factor;
+        }
+
+        void set_clamped(size_t index, bool clamped)
+        {
+            clamp_[index] = clamped ? 0xFFFFFFFFu : 0u;
+        }
+
+        // pos += vel * dt
+        void integrate(float dt);
+        // vel *= friction
+        void apply_friction();
+        // Bornes de l'écran pour les entités masquées
+        void clamp(float width, float height);
+
+        const float* pos_x() const { return px_.data(); }
+        const float* pos_y() const { return py_.data(); }
+        const float* vel_x() const { return vx_.data(); }
+        const float* vel_y() const { return vy_.data(); }
+
+    private:
+        size_t count_ = 0;
+        Array<float> px_;
+        Array<float> py_;
+        Array<float> vx_;
+        Array<float> vy_;
+        Array<float> friction_;
+        Array<uint32_t> clamp_;
+};
+
+}
+
+#endif /* !TRANSFORMSOA_HPP_ */
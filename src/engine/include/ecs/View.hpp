@@ -0,0 +1,220 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** View
+*/
+
+#ifndef VIEW_HPP_
+#define VIEW_HPP_
+#include "SparseSet.hpp"
+#include "ComponentMask.hpp"
+#include "Archetype.hpp"
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+/**
+ * @brief Tag listing components an entity must NOT have to be visited by a view
+ *
+ * Usage: registry.view<Position, Velocity>(ecs::exclude<NoFriction>)
+ */
+template <typename... Exclude>
+struct exclude_t {};
+
+template <typename... Exclude>
+inline constexpr exclude_t<Exclude...> exclude{};
+
+template <typename Excludes, typename... Include>
+class View;
+
+/**
+ * @brief Iterates the entities owning every Include component and none of the Exclude ones
+ *
+ * Iteration is driven by the smallest Include pool. When the Registry provides
+ * the entity signatures, membership (all Include, no Exclude) is decided with
+ * a mask test before any pool is probed; the matching entities then fetch
+ * their components with SparseSet::find (no has_entity + operator[] double
+ * lookup, no exception path). Callbacks receive the components by reference, optionally
+ * preceded by the entity: each([](Entity e, Position& p, Velocity& v) {...}) or
+ * each([](Position& p, Velocity& v) {...}).
+ *
+ * The driving pool is walked from its last element to its first, so the callback
+ * may remove components from (or destroy) the entity being visited, and entities
+ * created during the iteration are not visited.
+ *
+ * With an ArchetypeIndex (StorageBackend::Archetype), the matching archetypes
+ * are walked instead, rows from last to first; each component is read at its
+ * archetype segment position, checked against the entity, so the same
+ * modifications are allowed (an entity moved to another archetype during the
+ * iteration is not visited again).
+ */
+template <typename... Exclude, typename... Include>
+class View<exclude_t<Exclude...>, Include...> {
+    static_assert(sizeof...(Include) > 0, "A view needs at least one component type");
+
+    public:
+        // Un pool exclu à nullptr (type non enregistré) n'exclut rien
+        View(std::tuple<SparseSet<Include>*...> include, std::tuple<SparseSet<Exclude>*...> exclude)
+            : include_(include), exclude_(exclude) {}
+
+        // Avec les signatures des entités (indexées par slot) : filtre par masque
+        View(std::tuple<SparseSet<Include>*...> include, std::tuple<SparseSet<Exclude>*...> exclude,
+            const std::vector<ComponentMask>* signatures, ComponentMask include_mask, ComponentMask exclude_mask)
+            : include_(include), exclude_(exclude), signatures_(signatures),
+              include_mask_(include_mask), exclude_mask_(exclude_mask) {}
+
+        // Avec la table des archétypes : parcours archétype par archétype
+        View(std::tuple<SparseSet<Include>*...> include, std::tuple<SparseSet<Exclude>*...> exclude,
+            const std::vector<ComponentMask>* signatures, ComponentMask include_mask, ComponentMask exclude_mask,
+            ArchetypeIndex* archetypes)
+            : include_(include), exclude_(exclude), signatures_(signatures),
+              include_mask_(include_mask), exclude_mask_(exclude_mask), archetypes_(archetypes) {}
+
+        /**
+         * @brief Upper bound on the number of visited entities (size of the driving pool)
+         */
+        size_t size_hint() const
+        {
+            return driver().size();
+        }
+
+        bool contains(Entity entity) const
+        {
+            if (signatures_ && !signature_matches(entity))
+                return false;
+            return (std::get<SparseSet<Include>*>(include_)->has_entity(entity) && ...)
+                && !excluded(entity);
+        }
+
+        template <typename Func>
+        void each(Func&& func)
+        {
+            if (archetypes_) {
+                each_archetype(func);
+                return;
+            }
+            const std::pmr::vector<Entity>& entities = driver();
+
+            for (size_t i = entities.size(); i-- > 0;) {
+                if (i >= entities.size())
+                    continue;
+                Entity entity = entities[i];
+
+                if (signatures_) {
+                    if (!signature_matches(entity))
+                        continue;
+                } else if (excluded(entity)) {
+                    continue;
+                }
+                std::tuple<Include*...> components(std::get<SparseSet<Include>*>(include_)->find(entity)...);
+
+                if (((std::get<Include*>(components) == nullptr) || ...))
+                    continue;
+                if constexpr (std::is_invocable_v<Func&, Entity, Include&...>)
+                    func(entity, *std::get<Include*>(components)...);
+                else
+                    func(*std::get<Include*>(components)...);
+            }
+        }
+
+    private:
+        std::tuple<SparseSet<Include>*...> include_;
+        std::tuple<SparseSet<Exclude>*...> exclude_;
+        const std::vector<ComponentMask>* signatures_ = nullptr;
+        ComponentMask include_mask_;
+        ComponentMask exclude_mask_;
+        ArchetypeIndex* archetypes_ = nullptr;
+
+        template <typename Func>
+        void each_archetype(Func& func)
+        {
+            std::vector<std::pair<uint32_t, size_t>> matches;
+
+            archetypes_->compact(include_mask_);
+            // Tailles relevées au départ : une entité ajoutée à un archétype n'est pas visitée
+            archetypes_->for_each_match(include_mask_, exclude_mask_, [&matches](uint32_t id, size_t count) {
+                matches.emplace_back(id, count);
+            });
+            for (auto [id, count] : matches) {
+                // Début du segment de l'archétype dans chaque pool, relevé une fois
+                std::tuple<offset_t<Include>...> offsets(archetypes_->offset(ComponentFamily::id<Include>(), id)...);
+
+                for (size_t row = count; row-- > 0;) {
+                    const std::vector<Entity>& entities = archetypes_->archetype(id).entities;
+
+                    if (row >= entities.size())
+                        continue;
+                    Entity entity = entities[row];
+                    std::tuple<Include*...> components(fetch<Include>(std::get<offset_t<Include>>(offsets), row, entity)...);
+
+                    if (((std::get<Include*>(components) == nullptr) || ...))
+                        continue;
+                    if constexpr (std::is_invocable_v<Func&, Entity, Include&...>)
+                        func(entity, *std::get<Include*>(components)...);
+                    else
+                        func(*std::get<Include*>(components)...);
+                }
+            }
+        }
+
+        // Position d'un segment, un type par composant pour l'indexation du tuple
+        template <typename Component>
+        struct offset_t {
+            uint32_t value;
+
+            offset_t(uint32_t offset) : value(offset) {}
+        };
+
+        // Composant à sa position dans le segment de l'archétype, recherche sparse
+        // si le pool a été réordonné depuis (vue imbriquée, ajout pendant le parcours)
+        template <typename Component>
+        Component* fetch(offset_t<Component> offset, size_t row, Entity entity)
+        {
+            SparseSet<Component>* set = std::get<SparseSet<Component>*>(include_);
+
+            if (offset.value != ArchetypeIndex::NONE) {
+                size_t position = offset.value + row;
+                if (position < set->size() && set->entities()[position] == entity)
+                    return &set->unchecked_at(position);
+            }
+            return set->find(entity);
+        }
+
+        bool signature_matches(Entity entity) const
+        {
+            uint32_t slot = ecs::entity::index(entity);
+
+            if (slot >= signatures_->size())
+                return false;
+            const ComponentMask& signature = (*signatures_)[slot];
+            return signature.contains(include_mask_) && !signature.intersects(exclude_mask_);
+        }
+
+        const std::pmr::vector<Entity>& driver() const
+        {
+            const std::pmr::vector<Entity>* smallest = nullptr;
+
+            ((smallest = (!smallest || std::get<SparseSet<Include>*>(include_)->size() < smallest->size())
+                ? &std::get<SparseSet<Include>*>(include_)->entities() : smallest), ...);
+            return *smallest;
+        }
+
+        bool excluded(Entity entity) const
+        {
+            if constexpr (sizeof...(Exclude) == 0) {
+                (void)entity;
+                return false;
+            } else {
+                return ((std::get<SparseSet<Exclude>*>(exclude_)
+                    && std::get<SparseSet<Exclude>*>(exclude_)->has_entity(entity)) || ...);
+            }
+        }
+};
+
+}
+
+#endif /* !VIEW_HPP_ */
@@ -8,6 +8,10 @@
 #ifndef ISYSTEM_HPP_
 #define ISYSTEM_HPP_
 
+#include "ecs/SystemAccess.hpp"
+#include <atomic>
+#include <cstddef>
+
 class Registry;
 
 class ISystem {
@@ -18,8 +22,45 @@ class ISystem {
         virtual void init(Registry& registry) = 0;
         virtual void shutdown() = 0;
 
+        /**
+         * @brief Declare the components update() reads and writes
+         *
+         * Only used by the parallel execution mode of the Registry. The
+         * default is exclusive: the system never runs alongside another one.
+         */
+        virtual void declare_access(ecs::SystemAccess& access) const
+        {
+            access.exclusive();
+        }
+
     protected:
     private:
 };
 
+namespace ecs {
+
+/**
+ * @brief Dense per-type system identifier, same scheme as ComponentFamily
+ *
+ * Indexes the Registry system table: get_system<T>() is one vector access.
+ */
+class SystemFamily {
+    public:
+        template <typename System>
+        static size_t id()
+        {
+            static const size_t value = next();
+            return value;
+        }
+
+    private:
+        static size_t next()
+        {
+            static std::atomic<size_t> counter{0};
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
+};
+
+}
+
 #endif /* !ISYSTEM_HPP_ */
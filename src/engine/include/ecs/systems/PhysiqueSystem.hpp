@@ -16,6 +16,7 @@ class PhysiqueSystem : public ISystem {
     private:
         static constexpr float SCREEN_WIDTH = rtype::shared::config::SCREEN_WIDTH;
         static constexpr float SCREEN_HEIGHT = rtype::shared::config::SCREEN_HEIGHT;
+        static constexpr float FRICTION = 0.98f;
 
     public:
         virtual ~PhysiqueSystem() = default;
@@ -23,6 +24,7 @@ class PhysiqueSystem : public ISystem {
         void init(Registry& registry) override;
         void shutdown() override;
         void update(Registry& registry, float dt) override;
+        void declare_access(ecs::SystemAccess& access) const override;
 };
 
 #endif /* !PHYSIQUESYSTEM_HPP_ */
@@ -17,7 +17,8 @@
  *
  * Ce système parcourt toutes les entités ayant Position + Sprite
  * et les affiche via un plugin graphique (Raylib, SDL, SFML, etc.)
- * Les sprites sont triés par layer avant l'affichage pour gérer le z-ordering.
+ * Le pool Sprite est gardé trié par layer (tri incrémental en place, voir
+ * Registry::sort) pour gérer le z-ordering sans tri complet à chaque frame.
  */
 class RenderSystem : public ISystem {
     private:
@@ -25,6 +25,7 @@ public:
     void init(Registry& registry) override;
     void update(Registry& registry, float dt) override;
     void shutdown() override;
+    void declare_access(ecs::SystemAccess& access) const override;
 };
 
 #endif // SPRITE_ANIMATION_SYSTEM_HPP
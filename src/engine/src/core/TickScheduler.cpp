@@ -0,0 +1,79 @@
+#include "core/TickScheduler.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace core {
+
+/**
+ * @brief Constructor computing the step from the tick rate
+ *
+ * The step is exact to the nanosecond (15'625'000 ns at 64 ticks per
+ * second), unlike an integer millisecond interval.
+ */
+TickScheduler::TickScheduler(uint32_t tick_rate, CatchUpPolicy policy, uint32_t max_catch_up)
+    : tick_rate_(std::max<uint32_t>(tick_rate, 1)),
+      step_(std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(1000000000LL / tick_rate_))),
+      policy_(policy),
+      max_catch_up_(std::max<uint32_t>(max_catch_up, 1)),
+      spin_margin_(std::chrono::milliseconds(1)),
+      late_threshold_(step_ / 8) {}
+
+/**
+ * @brief Wait for the next deadline of the grid
+ *
+ * The time between the previous return and this call is the work of the
+ * previous tick: longer than a step, it counts as an overrun. Waking up
+ * more than an eighth of a step after the deadline counts as a late start.
+ * Every deadline already passed is a due step: the policy decides how many
+ * of them run now, the others are dropped. The next deadline stays on the
+ * grid in both cases.
+ */
+uint32_t TickScheduler::wait() {
+    Clock::time_point now = Clock::now();
+
+    if (!started_) {
+        started_ = true;
+        next_deadline_ = now;
+    } else if (now - tick_start_ > step_) {
+        overruns_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (now < next_deadline_) {
+        // Sommeil grossier, puis attente active pour la fin
+        if (next_deadline_ - now > spin_margin_)
+            std::this_thread::sleep_until(next_deadline_ - spin_margin_);
+        while ((now = Clock::now()) < next_deadline_)
+            std::this_thread::yield();
+    }
+
+    Clock::duration lateness = now - next_deadline_;
+    uint64_t due = 1 + static_cast<uint64_t>(lateness / step_);
+    uint64_t steps = policy_ == CatchUpPolicy::CatchUp ? std::min<uint64_t>(due, max_catch_up_) : 1;
+
+    if (lateness > late_threshold_)
+        late_starts_.fetch_add(1, std::memory_order_relaxed);
+    dropped_.fetch_add(due - steps, std::memory_order_relaxed);
+    ticks_.fetch_add(steps, std::memory_order_relaxed);
+    next_deadline_ += step_ * static_cast<Clock::rep>(due);
+    tick_start_ = now;
+    return static_cast<uint32_t>(steps);
+}
+
+void TickScheduler::reset() {
+    started_ = false;
+    ticks_.store(0, std::memory_order_relaxed);
+    overruns_.store(0, std::memory_order_relaxed);
+    late_starts_.store(0, std::memory_order_relaxed);
+    dropped_.store(0, std::memory_order_relaxed);
+}
+
+TickStats TickScheduler::stats() const {
+    TickStats stats;
+
+    stats.ticks = ticks_.load(std::memory_order_relaxed);
+    stats.overruns = overruns_.load(std::memory_order_relaxed);
+    stats.late_starts = late_starts_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}
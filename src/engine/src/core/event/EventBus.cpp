@@ -1,102 +1,77 @@
 #include "core/event/EventBus.hpp"
-#include <algorithm>
 
 namespace core {
 
 /**
- * @brief Constructor initializing the subscription ID counter
+ * @brief Constructor initializing the counters
  */
-EventBus::EventBus() : nextSubscriptionId_(0) {}
+EventBus::EventBus() : deferredCount_(0), nextSubscriptionId_(0), concurrentCount_(0) {}
 
 /**
- * @brief Internal implementation of subscription logic
+ * @brief Destructor releasing the events still waiting in the concurrent queue
  *
- * Adds a callback to the subscribers map for the given event type.
- * Each subscription is assigned a unique ID for later unsubscription.
- *
- * @param typeIndex The type_index of the event type
- * @param callback The callback function wrapped in type erasure
- * @return Unique subscription ID
- */
-EventBus::SubscriptionId EventBus::subscribeImpl(std::type_index typeIndex, Callback callback) {
-    SubscriptionId id = nextSubscriptionId_++;
-
-    subscribers_[typeIndex].push_back({id, callback});
-    return id;
-}
-
-/**
- * @brief Internal implementation of immediate event publishing
- *
- * Finds all subscribers for the given event type and invokes their
- * callbacks synchronously in the order they subscribed.
- *
- * @param typeIndex The type_index of the event type
- * @param event The event data wrapped in std::any
+ * Producer threads must have stopped publishing into this bus.
  */
-void EventBus::publishImpl(std::type_index typeIndex, const std::any& event) {
-    auto it = subscribers_.find(typeIndex);
-    if (it != subscribers_.end())
-        for (auto& [id, callback] : it->second)
-            callback(event);
+EventBus::~EventBus() {
+    while (ConcurrentEvent* pending = concurrent_.pop())
+        delete pending;
 }
 
 /**
- * @brief Internal implementation of deferred event publishing
+ * @brief Process all deferred events in the queue
  *
- * Creates a lambda that captures the event and type information,
- * then queues it for later execution during process_deferred().
+ * This method should typically be called once per frame, at a point where
+ * it's safe to handle all pending events (e.g., end of update loop).
  *
- * The event data is copied into the lambda to ensure it remains
- * valid when the deferred event is processed.
+ * Events are delivered in batches, one channel at a time, in the order in
+ * which each event type was first deferred; within a type they keep their
+ * FIFO order. Events deferred while delivering are processed by the same
+ * call, in a following batch. The ring buffers keep their capacity, so the
+ * next frame queues its events without allocating.
  *
- * @param typeIndex The type_index of the event type
- * @param event The event data wrapped in std::any
+ * Events published from other threads with publish_concurrent() are
+ * delivered first, in the order the queue hands them over.
  */
-void EventBus::publishDeferredImpl(std::type_index typeIndex, const std::any& event) {
-    auto publisher = [this, typeIndex, event]() {
-        auto it = subscribers_.find(typeIndex);
-        if (it != subscribers_.end())
-            for (auto& [id, callback] : it->second)
-                callback(event);
-    };
-    deferredEvents_.push(publisher);
+void EventBus::process_deferred() {
+    drain_concurrent();
+    while (!pendingChannels_.empty()) {
+        deliveringChannels_.swap(pendingChannels_);
+        for (IChannel* channel : deliveringChannels_) {
+            channel->queued = false;
+            deferredCount_ -= channel->deliver();
+        }
+        deliveringChannels_.clear();
+    }
 }
 
 /**
- * @brief Process all deferred events in the queue
+ * @brief Deliver the events published by other threads
  *
- * This method should typically be called once per frame, at a point where
- * it's safe to handle all pending events (e.g., end of update loop).
- *
- * Events are processed in FIFO order (first queued, first processed).
- * The queue is cleared after processing all events.
+ * Only the owning thread pops from the queue. An event whose producer is
+ * still linking it stays queued for the next call.
  */
-void EventBus::process_deferred() {
-    while (!deferredEvents_.empty()) {
-        auto& publisher = deferredEvents_.front();
-        publisher();
-        deferredEvents_.pop();
+void EventBus::drain_concurrent() {
+    while (ConcurrentEvent* pending = concurrent_.pop()) {
+        concurrentCount_.fetch_sub(1, std::memory_order_relaxed);
+        pending->forward(*this);
+        delete pending;
     }
 }
 
 /**
  * @brief Unsubscribe from events using a subscription ID
  *
- * Iterates through all event types and removes any subscription
- * matching the given ID. If the ID is not found, this method
- * does nothing (no error is thrown).
- *
- * Uses the erase-remove idiom for efficient removal from vectors.
+ * Looks for the subscription in every channel. If the ID is not found,
+ * this method does nothing (no error is thrown). Unsubscribing from inside
+ * a callback is safe: the subscriber is only removed once the current
+ * publish is over.
  *
  * @param subscriptionId The ID returned by subscribe()
  */
 void EventBus::unsubscribe(SubscriptionId subscriptionId) {
-    for (auto& [typeIndex, subs] : subscribers_) {
-        auto it = std::remove_if(subs.begin(), subs.end(),
-            [subscriptionId](const auto& sub) {return sub.first == subscriptionId;});
-        subs.erase(it, subs.end());
-    }
+    for (auto& channel : channels_)
+        if (channel && channel->unsubscribe(subscriptionId))
+            return;
 }
 
 /**
@@ -109,37 +84,27 @@ void EventBus::unsubscribe(SubscriptionId subscriptionId) {
  * - Subscription ID counter reset to 0
  */
 void EventBus::clear() {
-    subscribers_.clear();
-    while (!deferredEvents_.empty())
-        deferredEvents_.pop();
+    while (ConcurrentEvent* pending = concurrent_.pop()) {
+        concurrentCount_.fetch_sub(1, std::memory_order_relaxed);
+        delete pending;
+    }
+    pendingChannels_.clear();
+    channels_.clear();
+    deferredCount_ = 0;
     nextSubscriptionId_ = 0;
 }
 
-/**
- * @brief Internal implementation to get subscriber count
- *
- * Looks up the subscriber list for the given event type and
- * returns the number of active subscribers.
- *
- * @param typeIndex The type_index of the event type
- * @return Number of active subscribers, or 0 if none
- */
-size_t EventBus::getSubscriberCountImpl(std::type_index typeIndex) const {
-    auto it = subscribers_.find(typeIndex);
-
-    return (it != subscribers_.end()) ? it->second.size() : 0;
-}
-
 /**
  * @brief Get the number of deferred events waiting to be processed
  *
  * This can be useful for debugging or monitoring purposes to see
  * how many events are queued and waiting for process_deferred().
  *
- * @return Number of events in the deferred queue
+ * @return Number of events in the deferred queues of all channels, plus
+ *         the events published from other threads not yet drained
  */
 size_t EventBus::getDeferredEventCount() const {
-    return deferredEvents_.size();
+    return deferredCount_ + concurrentCount_.load(std::memory_order_relaxed);
 }
 
 }
@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** SystemScheduler
+*/
+
+#include "ecs/SystemScheduler.hpp"
+
+namespace ecs {
+
+SystemScheduler::SystemScheduler(size_t workers)
+{
+    workers_.reserve(workers);
+    for (size_t i = 0; i < workers; ++i)
+        workers_.emplace_back(&SystemScheduler::worker_loop, this);
+}
+
+SystemScheduler::~SystemScheduler()
+{
+    {
+        std::lock_guard lock(mutex_);
+        shutdown_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_)
+        if (worker.joinable())
+            worker.join();
+}
+
+void SystemScheduler::build(const std::vector<SystemAccess>& accesses)
+{
+    stages_.clear();
+    for (size_t i = 0; i < accesses.size(); ++i) {
+        bool conflict = stages_.empty();
+
+        if (!conflict) {
+            for (size_t other : stages_.back()) {
+                if (accesses[i].conflicts_with(accesses[other])) {
+                    conflict = true;
+                    break;
+                }
+            }
+        }
+        if (conflict)
+            stages_.emplace_back();
+        stages_.back().push_back(i);
+    }
+}
+
+void SystemScheduler::run_stage(const std::vector<size_t>& stage, const std::function<void(size_t)>& task)
+{
+    if (stage.empty())
+        return;
+
+    std::unique_lock lock(mutex_);
+    stage_ = &stage;
+    task_ = &task;
+    next_ = 0;
+    remaining_ = stage.size();
+    error_ = nullptr;
+    if (stage.size() > 1)
+        work_cv_.notify_all();
+
+    drain(lock);
+    done_cv_.wait(lock, [this] { return remaining_ == 0; });
+    stage_ = nullptr;
+    task_ = nullptr;
+
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    lock.unlock();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void SystemScheduler::drain(std::unique_lock<std::mutex>& lock)
+{
+    while (stage_ && next_ < stage_->size()) {
+        size_t index = (*stage_)[next_++];
+        const std::function<void(size_t)>& task = *task_;
+
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            task(index);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        if (error && !error_)
+            error_ = error;
+        if (--remaining_ == 0)
+            done_cv_.notify_all();
+    }
+}
+
+void SystemScheduler::worker_loop()
+{
+    std::unique_lock lock(mutex_);
+
+    while (true) {
+        work_cv_.wait(lock, [this] {
+            return shutdown_ || (stage_ && next_ < stage_->size());
+        });
+        if (shutdown_)
+            return;
+        drain(lock);
+    }
+}
+
+}
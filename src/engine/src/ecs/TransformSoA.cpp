@@ -0,0 +1,156 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** TransformSoA
+*/
+
+#include "ecs/TransformSoA.hpp"
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define ECS_SOA_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ECS_SOA_SSE2 1
+#endif
+
+namespace ecs {
+
+void TransformSoA::resize(size_t count)
+{
+    size_t padded = (count + LANES - 1) / LANES * LANES;
+
+    // Les lanes au-delà de count ne sont jamais relues : pas de remise à zéro par tick
+    count_ = count;
+    if (padded == px_.size())
+        return;
+    for (Array<float>* array : {&px_, &py_, &vx_, &vy_})
+        array->resize(padded, 0.0f);
+    friction_.resize(padded, 1.0f);
+    clamp_.resize(padded, 0u);
+}
+
+void TransformSoA::load(const Position* positions, const Velocity* velocities)
+{
+    for (size_t i = 0; i < count_; ++i) {
+        px_[i] = positions[i].x;
+        py_[i] = positions[i].y;
+        vx_[i] = velocities[i].x;
+        vy_[i] = velocities[i].y;
+    }
+}
+
+void TransformSoA::store(Position* positions, Velocity* velocities) const
+{
+    for (size_t i = 0; i < count_; ++i) {
+        positions[i].x = px_[i];
+        positions[i].y = py_[i];
+        velocities[i].x = vx_[i];
+        velocities[i].y = vy_[i];
+    }
+}
+
+void TransformSoA::integrate(float dt)
+{
+    size_t padded = px_.size();
+    float* px = px_.data();
+    float* py = py_.data();
+    const float* vx = vx_.data();
+    const float* vy = vy_.data();
+
+#if defined(ECS_SOA_AVX)
+    __m256 step = _mm256_set1_ps(dt);
+    for (size_t i = 0; i < padded; i += 8) {
+        // Multiplication puis addition séparées, comme la boucle scalaire
+        _mm256_store_ps(px + i, _mm256_add_ps(_mm256_load_ps(px + i), _mm256_mul_ps(_mm256_load_ps(vx + i), step)));
+        _mm256_store_ps(py + i, _mm256_add_ps(_mm256_load_ps(py + i), _mm256_mul_ps(_mm256_load_ps(vy + i), step)));
+    }
+#elif defined(ECS_SOA_SSE2)
+    __m128 step = _mm_set1_ps(dt);
+    for (size_t i = 0; i < padded; i += 4) {
+        _mm_store_ps(px + i, _mm_add_ps(_mm_load_ps(px + i), _mm_mul_ps(_mm_load_ps(vx + i), step)));
+        _mm_store_ps(py + i, _mm_add_ps(_mm_load_ps(py + i), _mm_mul_ps(_mm_load_ps(vy + i), step)));
+    }
+#else
+    for (size_t i = 0; i < padded; ++i) {
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+    }
+#endif
+}
+
+void TransformSoA::apply_friction()
+{
+    size_t padded = vx_.size();
+    float* vx = vx_.data();
+    float* vy = vy_.data();
+    const float* friction = friction_.data();
+
+#if defined(ECS_SOA_AVX)
+    for (size_t i = 0; i < padded; i += 8) {
+        __m256 factor = _mm256_load_ps(friction + i);
+        _mm256_store_ps(vx + i, _mm256_mul_ps(_mm256_load_ps(vx + i), factor));
+        _mm256_store_ps(vy + i, _mm256_mul_ps(_mm256_load_ps(vy + i), factor));
+    }
+#elif defined(ECS_SOA_SSE2)
+    for (size_t i = 0; i < padded; i += 4) {
+        __m128 factor = _mm_load_ps(friction + i);
+        _mm_store_ps(vx + i, _mm_mul_ps(_mm_load_ps(vx + i), factor));
+        _mm_store_ps(vy + i, _mm_mul_ps(_mm_load_ps(vy + i), factor));
+    }
+#else
+    for (size_t i = 0; i < padded; ++i) {
+        vx[i] *= friction[i];
+        vy[i] *= friction[i];
+    }
+#endif
+}
+
+void TransformSoA::clamp(float width, float height)
+{
+    size_t padded = px_.size();
+    float* px = px_.data();
+    float* py = py_.data();
+    const uint32_t* mask = clamp_.data();
+
+    // max(0, v) puis min(borne, ·) : un NaN traverse, comme avec les if scalaires
+#if defined(ECS_SOA_AVX)
+    __m256 zero = _mm256_setzero_ps();
+    __m256 maxX = _mm256_set1_ps(width);
+    __m256 maxY = _mm256_set1_ps(height);
+    for (size_t i = 0; i < padded; i += 8) {
+        __m256 select = _mm256_castsi256_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(mask + i)));
+        __m256 x = _mm256_load_ps(px + i);
+        __m256 y = _mm256_load_ps(py + i);
+        __m256 cx = _mm256_min_ps(maxX, _mm256_max_ps(zero, x));
+        __m256 cy = _mm256_min_ps(maxY, _mm256_max_ps(zero, y));
+        _mm256_store_ps(px + i, _mm256_blendv_ps(x, cx, select));
+        _mm256_store_ps(py + i, _mm256_blendv_ps(y, cy, select));
+    }
+#elif defined(ECS_SOA_SSE2)
+    __m128 zero = _mm_setzero_ps();
+    __m128 maxX = _mm_set1_ps(width);
+    __m128 maxY = _mm_set1_ps(height);
+    for (size_t i = 0; i < padded; i += 4) {
+        __m128 select = _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(mask + i)));
+        __m128 x = _mm_load_ps(px + i);
+        __m128 y = _mm_load_ps(py + i);
+        __m128 cx = _mm_min_ps(maxX, _mm_max_ps(zero, x));
+        __m128 cy = _mm_min_ps(maxY, _mm_max_ps(zero, y));
+        _mm_store_ps(px + i, _mm_or_ps(_mm_and_ps(select, cx), _mm_andnot_ps(select, x)));
+        _mm_store_ps(py + i, _mm_or_ps(_mm_and_ps(select, cy), _mm_andnot_ps(select, y)));
+    }
+#else
+    for (size_t i = 0; i < padded; ++i) {
+        if (!mask[i])
+            continue;
+        if (px[i] < 0) px[i] = 0;
+        if (px[i] > width) px[i] = width;
+        if (py[i] < 0) py[i] = 0;
+        if (py[i] > height) py[i] = height;
+    }
+#endif
+}
+
+}
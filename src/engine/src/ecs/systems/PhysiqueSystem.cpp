@@ -18,30 +18,25 @@ void PhysiqueSystem::shutdown()
     std::cout << "PhysiqueSystem: Arrêt." << std::endl;
 }
 
+void PhysiqueSystem::declare_access(ecs::SystemAccess& access) const
+{
+    access.reads<Controllable, NoFriction>().writes<Position, Velocity>();
+}
+
 void PhysiqueSystem::update(Registry& registry, float dt)
 {
-    auto& positions = registry.get_components<Position>();
-    auto& velocitys = registry.get_components<Velocity>();
     auto& controllables = registry.get_components<Controllable>();
     auto& noFrictions = registry.get_components<NoFriction>();
 
-    for (size_t i = 0; i < velocitys.size(); i++)
-    {
-        Entity entity = velocitys.get_entity_at(i);
-
-        if (!(positions.has_entity(entity)))
-            continue;
-
-        auto& pos = positions[entity];
-        auto& vel = velocitys[entity];
-
+    // Groupe possédant : Position et Velocity alignées, balayage linéaire
+    registry.group<Position, Velocity>().each([&](Entity entity, Position& pos, Velocity& vel) {
         pos.x += vel.x * dt;
         pos.y += vel.y * dt;
 
         //FRICTION : Appliquer uniquement aux entités qui n'ont PAS le tag NoFriction
         if (!noFrictions.has_entity(entity)){
-            vel.x *= 0.98f;
-            vel.y *= 0.98f;
+            vel.x *= FRICTION;
+            vel.y *= FRICTION;
         }
 
         if (controllables.has_entity(entity)) {
@@ -53,5 +48,5 @@ void PhysiqueSystem::update(Registry& registry, float dt)
             if (pos.y < 0) pos.y = 0;
             if (pos.y > SCREEN_HEIGHT) pos.y = SCREEN_HEIGHT;
         }
-    }
+    });
 }
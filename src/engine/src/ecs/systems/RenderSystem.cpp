@@ -40,46 +40,29 @@ void RenderSystem::update(Registry& registry, float dt)
     auto& positions = registry.get_components<Position>();
     auto& sprites = registry.get_components<Sprite>();
 
-    // Structure temporaire pour stocker les entités à dessiner
-    struct RenderData {
-        Entity entity;
-        int layer;
-    };
-
-    // Collecter toutes les entités avec Position + Sprite
-    std::vector<RenderData> render_queue;
-    render_queue.reserve(positions.size()); // Pré-allouer pour éviter les réallocations
-
-    for (size_t i = 0; i < positions.size(); i++) {
-        Entity entity = positions.get_entity_at(i);
-
-        // Vérifier que l'entité a aussi un Sprite
-        if (!sprites.has_entity(entity)) {
-            continue;
-        }
+    // Sprites triés en place par layer (ordre croissant = fond en premier). Les layers
+    // changent rarement : le tri par insertion ne replace que les sprites ajoutés ou
+    // modifiés depuis la frame précédente, sans allocation ni tri complet
+    registry.sort<Sprite>([](const Sprite& a, const Sprite& b) {
+            return a.layer < b.layer;
+        }, ecs::SortMode::Incremental);
 
-        const Sprite& sprite = sprites.get_data_by_entity_id(entity);
+    // Dessiner toutes les entités dans l'ordre des layers
+    for (size_t i = 0; i < sprites.size(); i++) {
+        Entity entity = sprites.get_entity_at(i);
+        const Sprite& sprite = sprites.get_data_at(i);
 
         // Ignorer les sprites sans texture
         if (sprite.texture == engine::INVALID_HANDLE) {
             continue;
         }
 
-        // Ajouter à la queue de rendu
-        render_queue.push_back({entity, sprite.layer});
-    }
-
-    // Trier par layer (ordre croissant = fond en premier)
-    std::sort(render_queue.begin(), render_queue.end(),
-        [](const RenderData& a, const RenderData& b) {
-            return a.layer < b.layer;
-        });
-
-
-    // Dessiner toutes les entités dans l'ordre des layers
-    for (const auto& render_data : render_queue) {
-        const Position& pos = positions.get_data_by_entity_id(render_data.entity);
-        const Sprite& sprite = sprites.get_data_by_entity_id(render_data.entity);
+        // Vérifier que l'entité a aussi une Position
+        const Position* position = positions.find(entity);
+        if (!position) {
+            continue;
+        }
+        const Position& pos = *position;
 
         // Préparer le sprite pour le plugin (réutilise temp_sprite pour éviter allocations)
         temp_sprite.texture_handle = sprite.texture;
@@ -100,8 +83,8 @@ void RenderSystem::update(Registry& registry, float dt)
         // Si l'entité a un FlashOverlay, redessiner le sprite en blanc avec blend additif
         if (registry.has_component_registered<FlashOverlay>()) {
             auto& overlays = registry.get_components<FlashOverlay>();
-            if (overlays.has_entity(render_data.entity)) {
-                const FlashOverlay& overlay = overlays[render_data.entity];
+            if (overlays.has_entity(entity)) {
+                const FlashOverlay& overlay = overlays[entity];
 
                 // Calculer l'alpha basé sur le temps restant (plus lumineux au début)
                 float progress = overlay.time_remaining / overlay.total_duration;
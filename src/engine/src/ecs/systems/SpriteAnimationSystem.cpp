@@ -15,21 +15,10 @@ void SpriteAnimationSystem::init(Registry& registry) {
 }
 
 void SpriteAnimationSystem::update(Registry& registry, float dt) {
-    auto& animations = registry.get_components<SpriteAnimation>();
-    auto& sprites = registry.get_components<Sprite>();
-
-    for (size_t i = 0; i < animations.size(); ++i) {
-        Entity entity = animations.get_entity_at(i);
-
-        if (!animations.has_entity(entity) || !sprites.has_entity(entity))
-            continue;
-
-        SpriteAnimation& anim = animations[entity];
-        Sprite& sprite = sprites[entity];
-
+    registry.view<SpriteAnimation, Sprite>().each([dt](SpriteAnimation& anim, Sprite& sprite) {
         // Skip if not playing or no frames
         if (!anim.playing || anim.frames.empty())
-            continue;
+            return;
 
         // Update elapsed time
         anim.elapsedTime += dt;
@@ -54,7 +43,11 @@ void SpriteAnimationSystem::update(Registry& registry, float dt) {
             // Update sprite texture
             sprite.texture = anim.frames[anim.currentFrame];
         }
-    }
+    });
+}
+
+void SpriteAnimationSystem::declare_access(ecs::SystemAccess& access) const {
+    access.writes<SpriteAnimation, Sprite>();
 }
 
 void SpriteAnimationSystem::shutdown() {
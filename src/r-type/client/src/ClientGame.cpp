@@ -946,6 +946,7 @@ void ClientGame::setup_network_callbacks() {
 
             if (scores.has_entity(entity)) {
                 scores[entity].value = score.new_total_score;
+                scores.touch(entity);
                 std::cout << "[CLIENT] ✅ Score updated for player " << player_id
                           << " (server_entity " << server_entity_id
                           << ", local_entity " << entity << "): " << score.new_total_score << std::endl;
@@ -1295,6 +1296,7 @@ void ClientGame::setup_network_callbacks() {
             if (healths.has_entity(entity)) {
                 healths[entity].current = static_cast<int>(hp);
                 healths[entity].max = std::max(healths[entity].max, static_cast<int>(hp));
+                healths.touch(entity);
             } else {
                 Health comp;
                 comp.current = static_cast<int>(hp);
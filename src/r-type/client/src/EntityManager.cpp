@@ -484,6 +484,7 @@ Entity EntityManager::spawn_or_update_entity(uint32_t server_id, protocol::Entit
     if (healths.has_entity(entity)) {
         healths[entity].current = hp;
         healths[entity].max = std::max(healths[entity].max, hp);
+        healths.touch(entity);
     } else {
         Health comp;
         comp.current = hp;
@@ -539,7 +540,7 @@ Entity EntityManager::spawn_or_update_entity(uint32_t server_id, protocol::Entit
             anim.frameTime = 0.1f;
             anim.loop = true;
             anim.playing = true;
-            registry_.add_component(entity, anim);
+            registry_.add_component(entity, std::move(anim));
         }
         ensure_player_name_tag(server_id, x, y);
         // Note: Le vaisseau bonus n'est plus créé automatiquement ici
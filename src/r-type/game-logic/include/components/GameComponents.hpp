@@ -320,6 +320,35 @@ struct NetworkId {
     uint32_t server_entity_id = 0;  // Server-side entity ID for network sync
 };
 
+// Composants capturés par Registry::save_snapshot (les composants avec std::string
+// ou std::vector, comme Script ou WaveController, n'y participent pas)
+ECS_SNAPSHOT_COMPONENT(NetworkPlayerId);
+ECS_SNAPSHOT_COMPONENT(AI);
+ECS_SNAPSHOT_COMPONENT(Scrollable);
+ECS_SNAPSHOT_COMPONENT(Weapon);
+ECS_SNAPSHOT_COMPONENT(LaserBeam);
+ECS_SNAPSHOT_COMPONENT(FireRate);
+ECS_SNAPSHOT_COMPONENT(Enemy);
+ECS_SNAPSHOT_COMPONENT(Projectile);
+ECS_SNAPSHOT_COMPONENT(ProjectileOwner);
+ECS_SNAPSHOT_COMPONENT(ShotAnimation);
+ECS_SNAPSHOT_COMPONENT(Wall);
+ECS_SNAPSHOT_COMPONENT(Background);
+ECS_SNAPSHOT_COMPONENT(Kamikaze);
+ECS_SNAPSHOT_COMPONENT(Health);
+ECS_SNAPSHOT_COMPONENT(Invulnerability);
+ECS_SNAPSHOT_COMPONENT(Damage);
+ECS_SNAPSHOT_COMPONENT(Score);
+ECS_SNAPSHOT_COMPONENT(WaveEntityTag);
+ECS_SNAPSHOT_COMPONENT(ActiveWave);
+ECS_SNAPSHOT_COMPONENT(WaveTrigger);
+ECS_SNAPSHOT_COMPONENT(Bonus);
+ECS_SNAPSHOT_COMPONENT(BonusLifetime);
+ECS_SNAPSHOT_COMPONENT(Shield);
+ECS_SNAPSHOT_COMPONENT(SpeedBoost);
+ECS_SNAPSHOT_COMPONENT(BonusWeapon);
+ECS_SNAPSHOT_COMPONENT(GameState);
+ECS_SNAPSHOT_COMPONENT(NetworkId);
 
 
 #endif /* !GAME_COMPONENTS_HPP_ */
@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 #include "Entity.hpp"
+#include "ecs/Snapshot.hpp"
 #include "plugin_manager/CommonTypes.hpp"
 
 namespace rtype {
@@ -219,4 +220,9 @@ struct PlayerLives {
 } // namespace game
 } // namespace rtype
 
+// BossPhase (std::vector de phases) n'est pas capturé
+ECS_SNAPSHOT_COMPONENT(rtype::game::LevelController);
+ECS_SNAPSHOT_COMPONENT(rtype::game::ScrollState);
+ECS_SNAPSHOT_COMPONENT(rtype::game::PlayerLives);
+
 #endif // LEVEL_COMPONENTS_HPP
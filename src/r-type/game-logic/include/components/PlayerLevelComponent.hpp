@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include "ecs/Snapshot.hpp"
 #include "GameComponents.hpp"
 #include "ShipComponents.hpp"
 
@@ -161,3 +162,5 @@ struct PlayerLevel {
 };
 
 } // namespace rtype::game
+
+ECS_SNAPSHOT_COMPONENT(rtype::game::PlayerLevel);
@@ -22,6 +22,7 @@ class AISystem : public ISystem {
         void init(Registry& registry) override;
         void update(Registry& registry, float dt) override;
         void shutdown() override;
+        void declare_access(ecs::SystemAccess& access) const override;
 
     private:
         engine::IGraphicsPlugin& graphics_;
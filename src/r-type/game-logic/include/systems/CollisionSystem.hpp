@@ -10,6 +10,7 @@
 #include "ecs/Registry.hpp"
 #include "ecs/CoreComponents.hpp"
 #include "ecs/systems/ISystem.hpp"
+#include <vector>
 
 class CollisionSystem : public ISystem {
     private:
@@ -20,6 +21,15 @@ class CollisionSystem : public ISystem {
         // Scroll offset for world<->screen coordinate conversion
         // Walls are in WORLD coordinates, players/projectiles in SCREEN coordinates
         float m_currentScroll = 0.0f;
+
+        // Wall hitboxes (world coordinates) rebuilt each update, capacity kept across frames
+        struct WallBox {
+            float left;
+            float right;
+            float top;
+            float bottom;
+        };
+        std::vector<WallBox> m_wallBoxes;
     public:
         virtual ~CollisionSystem() = default;
 
@@ -39,38 +49,21 @@ class CollisionSystem : public ISystem {
         template<typename TypeA, typename TypeB, typename Action>
         void scan_collisions(Registry& registry, Action action)
         {
-            auto& positions = registry.get_components<Position>();
-            auto& colliders = registry.get_components<Collider>();
-            auto& typeA = registry.get_components<TypeA>();
-            auto& typeB = registry.get_components<TypeB>();
-
-            for (size_t i = 0; i < typeA.size(); i++)
-            {
-                Entity entity_A = typeA.get_entity_at(i);
-
-                if (!positions.has_entity(entity_A) || !colliders.has_entity(entity_A))
-                    continue;
+            auto viewB = registry.view<TypeB, Position, Collider>();
 
-                const Position& posA = positions.get_data_by_entity_id(entity_A);
-                const Collider& colA = colliders.get_data_by_entity_id(entity_A);
-
-                for (size_t j = 0; j < typeB.size(); j++)
-                {
-                    Entity entity_B = typeB.get_entity_at(j);
-
-                    if (!positions.has_entity(entity_B) || !colliders.has_entity(entity_B))
-                        continue;
+            registry.view<TypeA, Position, Collider>().each([&](Entity entity_A, TypeA&, Position& pA, Collider& cA) {
+                // Copies : l'action peut créer des entités et réallouer les pools
+                const Position posA = pA;
+                const Collider colA = cA;
 
+                viewB.each([&](Entity entity_B, TypeB&, Position& posB, Collider& colB) {
                     if (entity_A == entity_B)
-                        continue;
-
-                    const Position& posB = positions.get_data_by_entity_id(entity_B);
-                    const Collider& colB = colliders.get_data_by_entity_id(entity_B);
+                        return;
 
                     if (check_collision(posA, posB, colA, colB))
                         action(entity_A, entity_B);
-                }
-            }
+                });
+            });
         }
 };
 
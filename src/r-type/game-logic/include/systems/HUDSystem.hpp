@@ -97,6 +97,13 @@ private:
     float m_pulseTimer = 0.0f;           // For pulsing effects
     float m_timeSincePlayerDisappeared = 0.0f;  // Grace period before hiding HUD
 
+    // Change tracking: health/score texts are only rebuilt when the values changed
+    uint32_t m_lastChangeTick = 0;       // Registry change tick of the previous update
+    Entity m_healthTextOwner = 0;        // Entity whose health the text currently shows
+    Entity m_scoreTextOwner = 0;         // Entity whose score the text currently shows
+    bool m_healthTextValid = false;
+    bool m_scoreTextValid = false;
+
     // HUD Layout Constants
     static constexpr float MARGIN = 30.0f;
     static constexpr float HEALTH_BAR_WIDTH = 400.0f;
@@ -27,6 +27,8 @@ class LuaSystem : public ISystem {
         sol::state lua_;
         std::unordered_map<std::string, sol::function> scriptCache_;
         std::unordered_map<std::string, sol::function> bossScriptCache_;
+        // Modèle des projectiles tirés par les scripts (salves instanciées en bloc)
+        ecs::Prefab enemyProjectile_;
 
         void bindComponents(Registry& registry);
         void bindBossFunctions(Registry& registry);
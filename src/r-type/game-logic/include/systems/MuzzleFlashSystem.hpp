@@ -13,7 +13,6 @@
 #include "components/GameComponents.hpp"
 #include "plugin_manager/IGraphicsPlugin.hpp"
 #include <cstdint>
-#include <unordered_map>
 
 /**
  * @brief System that manages muzzle flash effects using ECS events
@@ -23,7 +22,9 @@
  * - MuzzleFlashDestroyEvent: Destroys a shooter's muzzle flash
  *
  * The muzzle flash is rendered using standard Sprite/Position/Attached components
- * and uses ShotAnimation for frame switching.
+ * and uses ShotAnimation for frame switching. It is linked as a child of its
+ * shooter (Registry::set_parent): AttachmentSystem moves it along, and the
+ * shooter's flash is found among its children instead of in a side table.
  */
 class MuzzleFlashSystem : public ISystem {
 public:
@@ -46,9 +47,6 @@ private:
     size_t spawnSubId_ = 0;
     size_t destroySubId_ = 0;
 
-    // Track muzzle flash entities by shooter entity
-    std::unordered_map<Entity, Entity> shooterToFlash_;
-
     /**
      * @brief Create a muzzle flash entity attached to a shooter
      */
@@ -59,10 +57,20 @@ private:
      */
     void destroyMuzzleFlash(Registry& registry, Entity shooter);
 
+    /**
+     * @brief Hide a muzzle flash entity and mark it for destruction
+     */
+    void removeMuzzleFlash(Registry& registry, Entity flashEntity);
+
+    /**
+     * @brief Muzzle flash of a shooter (child with a ShotAnimation), ecs::Hierarchy::NONE if none
+     */
+    Entity findMuzzleFlash(Registry& registry, Entity shooter) const;
+
     /**
      * @brief Check if a shooter already has an active muzzle flash
      */
-    bool hasActiveMuzzleFlash(Entity shooter) const;
+    bool hasActiveMuzzleFlash(Registry& registry, Entity shooter) const;
 };
 
 #endif /* !MUZZLEFLASHSYSTEM_HPP_ */
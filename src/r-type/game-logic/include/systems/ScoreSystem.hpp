@@ -19,6 +19,7 @@ public:
     void init(Registry& registry) override;
     void update(Registry& registry, float dt) override;
     void shutdown() override;
+    void declare_access(ecs::SystemAccess& access) const override;
 
 private:
     core::EventBus::SubscriptionId enemyKilledSubId_;
@@ -37,6 +37,13 @@ void AISystem::shutdown()
     if (bulletTex_) graphics_.unload_texture(bulletTex_);
 }
 
+void AISystem::declare_access(ecs::SystemAccess& access) const
+{
+    // Les projectiles passent par le CommandBuffer : leurs composants comptent comme écrits
+    access.reads<Controllable, Kamikaze>()
+        .writes<AI, Position, Velocity, Sprite, Collider, Projectile, ProjectileOwner, NoFriction>();
+}
+
 void AISystem::update(Registry& registry, float dt)
 {
     // AI Behavior only - spawning is handled by WaveSpawnerSystem
@@ -155,10 +162,11 @@ void AISystem::updateEnemyBehavior(Registry& registry, float dt)
                      spawnY += sprites[e].height / 2.0f;
                  }
                  
+                 ecs::CommandBuffer& commands = registry.commands();
                  auto createBullet = [&](float vy_offset) {
-                     Entity bullet = registry.spawn_entity();
-                     registry.add_component(bullet, Position{spawnX, spawnY});
-                     registry.add_component(bullet, Velocity{-400.0f, vy_offset}); // Shoot left with optional Y spread
+                     Entity bullet = commands.spawn();
+                     commands.add(bullet, Position{spawnX, spawnY});
+                     commands.add(bullet, Velocity{-400.0f, vy_offset}); // Shoot left with optional Y spread
                      Sprite bulletSprite{
                          bulletTex_,
                          bulletWidth,
@@ -169,11 +177,11 @@ void AISystem::updateEnemyBehavior(Registry& registry, float dt)
                      bulletSprite.source_rect = {16.0f, 0.0f, 16.0f, 16.0f};
                      bulletSprite.origin_x = bulletWidth / 2.0f;
                      bulletSprite.origin_y = bulletHeight / 2.0f;
-                     registry.add_component(bullet, bulletSprite);
-                     registry.add_component(bullet, Collider{bulletWidth, bulletHeight});
-                     registry.add_component(bullet, Projectile{180.0f, 5.0f, 0.0f, ProjectileFaction::Enemy});
-                     registry.add_component(bullet, ProjectileOwner{e});  // Track which enemy fired this
-                     registry.add_component(bullet, NoFriction{});
+                     commands.add(bullet, bulletSprite);
+                     commands.add(bullet, Collider{bulletWidth, bulletHeight});
+                     commands.add(bullet, Projectile{180.0f, 5.0f, 0.0f, ProjectileFaction::Enemy});
+                     commands.add(bullet, ProjectileOwner{e});  // Track which enemy fired this
+                     commands.add(bullet, NoFriction{});
                  };
 
                  createBullet(0.0f); // Center bullet
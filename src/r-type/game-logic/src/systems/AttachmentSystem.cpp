@@ -10,9 +10,33 @@
 #include "ecs/Registry.hpp"
 #include <cmath>
 
+namespace {
+
+// Reporte le parent d'un composant Attached dans les liens du registry
+void link_attached(Registry& registry, Entity entity)
+{
+    const Attached& attached = registry.get_components<Attached>()[entity];
+    Entity parent = static_cast<Entity>(attached.parentEntity);
+
+    if (parent != entity && registry.is_alive(parent))
+        registry.set_parent(entity, parent);
+}
+
+}
+
 void AttachmentSystem::init(Registry& registry)
 {
-    (void)registry;
+    auto& attacheds = registry.get_components<Attached>();
+
+    // Les liens parent/enfant du registry suivent les composants Attached
+    for (size_t i = 0; i < attacheds.size(); i++)
+        link_attached(registry, attacheds.get_entity_at(i));
+    registry.on_construct<Attached>().connect([&registry](Entity entity) {
+        link_attached(registry, entity);
+    });
+    registry.on_destroy<Attached>().connect([&registry](Entity entity) {
+        registry.set_parent(entity, ecs::Hierarchy::NONE);
+    });
 }
 
 void AttachmentSystem::update(Registry& registry, float dt)
@@ -20,35 +44,30 @@ void AttachmentSystem::update(Registry& registry, float dt)
     auto& positions = registry.get_components<Position>();
     auto& attacheds = registry.get_components<Attached>();
 
-    for (size_t i = 0; i < attacheds.size(); i++) {
-        Entity entity = attacheds.get_entity_at(i);
-
-        if (!attacheds.has_entity(entity) || !positions.has_entity(entity))
-            continue;
-
-        auto& attached = attacheds[entity];
-
-        // Check if parent exists
-        if (positions.has_entity(attached.parentEntity)) {
-            const auto& parentPos = positions[attached.parentEntity];
-            auto& pos = positions[entity];
-
-            // Calculer la position cible
-            float targetX = parentPos.x + attached.offsetX;
-            float targetY = parentPos.y + attached.offsetY;
-
-            // Si smoothFactor > 0, on interpole avec latence (effet de suivi)
-            // Sinon, on positionne directement (comportement original)
-            if (attached.smoothFactor > 0.0f) {
-                // Interpolation exponentielle (lerp) pour un suivi fluide
-                float lerpFactor = 1.0f - std::exp(-attached.smoothFactor * dt);
-                pos.x += (targetX - pos.x) * lerpFactor;
-                pos.y += (targetY - pos.y) * lerpFactor;
-            } else {
-                // Positionnement direct (pas de latence)
-                pos.x = targetX;
-                pos.y = targetY;
-            }
+    // Parents avant enfants : une chaîne (joueur -> compagnon -> flash) est à jour en un passage
+    registry.each_link([&](Entity parent, Entity entity) {
+        Attached* attached = attacheds.find(entity);
+        Position* pos = positions.find(entity);
+        const Position* parentPos = positions.find(parent);
+
+        if (!attached || !pos || !parentPos)
+            return;
+
+        // Calculer la position cible
+        float targetX = parentPos->x + attached->offsetX;
+        float targetY = parentPos->y + attached->offsetY;
+
+        // Si smoothFactor > 0, on interpole avec latence (effet de suivi)
+        // Sinon, on positionne directement (comportement original)
+        if (attached->smoothFactor > 0.0f) {
+            // Interpolation exponentielle (lerp) pour un suivi fluide
+            float lerpFactor = 1.0f - std::exp(-attached->smoothFactor * dt);
+            pos->x += (targetX - pos->x) * lerpFactor;
+            pos->y += (targetY - pos->y) * lerpFactor;
+        } else {
+            // Positionnement direct (pas de latence)
+            pos->x = targetX;
+            pos->y = targetY;
         }
-    }
+    });
 }
@@ -232,6 +232,7 @@ void BonusSystem::handleBonusCollection(Registry& registry)
                         if (healths.has_entity(playerEntity)) {
                             Health& health = healths[playerEntity];
                             health.current = std::min(health.current + HEALTH_BONUS_AMOUNT, health.max);
+                            healths.touch(playerEntity);
                             std::cout << "BonusSystem: Joueur récupère +" << HEALTH_BONUS_AMOUNT << " HP (HP: " << health.current << "/" << health.max << ")" << std::endl;
                         }
                         break;
@@ -67,35 +67,35 @@ void CollisionSystem::update(Registry& registry, float dt)
     }
 
     // Update Invulnerability timers
-    auto& invulnerabilities = registry.get_components<Invulnerability>();
-    for (size_t i = 0; i < invulnerabilities.size(); i++) {
-        Entity entity = invulnerabilities.get_entity_at(i);
-        auto& invul = invulnerabilities[entity];
+    registry.view<Invulnerability>().each([dt](Invulnerability& invul) {
         if (invul.time_remaining > 0.0f)
             invul.time_remaining -= dt;
-    }
+    });
 
     auto& damages = registry.get_components<Damage>();
     auto& projectiles = registry.get_components<Projectile>();
-    auto hide_projectile_sprite = [&registry](Entity projectile) {
+    // Les changements structurels des projectiles sont différés pendant les scans
+    // et appliqués en une fois à la fin de update()
+    ecs::CommandBuffer& commands = registry.commands();
+    auto destroy_projectile = [&registry, &commands](Entity projectile) {
+        commands.add(projectile, ToDestroy{});
         if (!registry.has_component_registered<Sprite>())
             return;
         auto& sprites = registry.get_components<Sprite>();
         if (!sprites.has_entity(projectile))
             return;
-        registry.remove_component<Sprite>(projectile);
+        commands.remove<Sprite>(projectile);
     };
 
     // Collision Projectile (joueur) vs Enemy : Applique les dégâts à l'ennemi
-    scan_collisions<Projectile, Enemy>(registry, [&registry, &damages, &projectiles, &hide_projectile_sprite](Entity bullet, Entity enemy) {
+    scan_collisions<Projectile, Enemy>(registry, [&registry, &damages, &projectiles, &destroy_projectile](Entity bullet, Entity enemy) {
         if (!projectiles.has_entity(bullet))
             return;
 
         if (projectiles[bullet].faction != ProjectileFaction::Player)
             return;
 
-        registry.add_component(bullet, ToDestroy{});
-        hide_projectile_sprite(bullet);
+        destroy_projectile(bullet);
         // TODO: publier un ProjectileHitEvent ici pour déclencher un VFX/SFX côté client.
 
         int dmg = damages.has_entity(bullet) ? damages[bullet].value : 10;
@@ -105,15 +105,14 @@ void CollisionSystem::update(Registry& registry, float dt)
     // Collision Projectile (ennemi) vs Player : Applique les dégâts au joueur (ou casse le bouclier)
     auto& shields = registry.get_components<Shield>();
 
-    scan_collisions<Projectile, Controllable>(registry, [&registry, &damages, &projectiles, &shields, &hide_projectile_sprite](Entity bullet, Entity player) {
+    scan_collisions<Projectile, Controllable>(registry, [&registry, &damages, &projectiles, &shields, &destroy_projectile](Entity bullet, Entity player) {
         if (!projectiles.has_entity(bullet))
             return;
 
         if (projectiles[bullet].faction != ProjectileFaction::Enemy)
             return;
 
-        registry.add_component(bullet, ToDestroy{});
-        hide_projectile_sprite(bullet);
+        destroy_projectile(bullet);
         // TODO: publier un ProjectileHitEvent ici pour déclencher un VFX/SFX côté client.
 
         // Vérifier si le joueur a un bouclier actif
@@ -201,23 +200,19 @@ void CollisionSystem::update(Registry& registry, float dt)
         registry.get_event_bus().publish(ecs::DamageEvent{player, enemy, 25});
     });
 
+    // Wall hitboxes in world coordinates (center-based), gathered once and
+    // reused by the player, enemy and projectile passes below
+    m_wallBoxes.clear();
+    registry.view<Wall, Position, Collider>().each([this](Wall&, Position& posW, Collider& colW) {
+        float half_ww = colW.width * 0.5f;
+        float half_wh = colW.height * 0.5f;
+        m_wallBoxes.push_back({posW.x - half_ww, posW.x + half_ww, posW.y - half_wh, posW.y + half_wh});
+    });
+
     // Collision Player vs Wall : Scroll-aware collision
     // Players are in SCREEN coordinates, Walls are in WORLD coordinates
     // Convert player position to world coordinates using m_currentScroll
-    auto& positions = registry.get_components<Position>();
-    auto& colliders = registry.get_components<Collider>();
-    auto& controllables = registry.get_components<Controllable>();
-    auto& walls = registry.get_components<Wall>();
-
-    for (size_t i = 0; i < controllables.size(); i++) {
-        Entity player = controllables.get_entity_at(i);
-
-        if (!positions.has_entity(player) || !colliders.has_entity(player))
-            continue;
-
-        Position& posP = positions[player];
-        const Collider& colP = colliders[player];
-
+    registry.view<Controllable, Position, Collider>().each([this](Controllable&, Position& posP, Collider& colP) {
         // Convert player SCREEN position to WORLD position
         float player_world_x = posP.x + m_currentScroll;
 
@@ -229,30 +224,14 @@ void CollisionSystem::update(Registry& registry, float dt)
         float p_top = posP.y - half_ph;
         float p_bottom = posP.y + half_ph;
 
-        for (size_t j = 0; j < walls.size(); j++) {
-            Entity wall = walls.get_entity_at(j);
-
-            if (!positions.has_entity(wall) || !colliders.has_entity(wall))
-                continue;
-
-            const Position& posW = positions[wall];
-            const Collider& colW = colliders[wall];
-
-            // Wall hitbox in world coordinates (center-based)
-            float half_ww = colW.width * 0.5f;
-            float half_wh = colW.height * 0.5f;
-            float w_left = posW.x - half_ww;
-            float w_right = posW.x + half_ww;
-            float w_top = posW.y - half_wh;
-            float w_bottom = posW.y + half_wh;
-
+        for (const WallBox& wall : m_wallBoxes) {
             // AABB collision check
-            if (p_right > w_left && p_left < w_right && p_bottom > w_top && p_top < w_bottom) {
+            if (p_right > wall.left && p_left < wall.right && p_bottom > wall.top && p_top < wall.bottom) {
                 // Calculate penetration depths for each side
-                float pen_left = p_right - w_left;
-                float pen_right = w_right - p_left;
-                float pen_top = p_bottom - w_top;
-                float pen_bottom = w_bottom - p_top;
+                float pen_left = p_right - wall.left;
+                float pen_right = wall.right - p_left;
+                float pen_top = p_bottom - wall.top;
+                float pen_bottom = wall.bottom - p_top;
 
                 // Find minimum penetration
                 float min_pen = pen_left;
@@ -271,21 +250,12 @@ void CollisionSystem::update(Registry& registry, float dt)
                 }
             }
         }
-    }
+    });
 
     // Collision Enemy vs Wall
     // Enemies are in WORLD coordinates (no Scrollable component, spawned at absolute positions)
     // Walls are also in WORLD coordinates - compare directly, no conversion needed
-    auto& enemies = registry.get_components<Enemy>();
-    for (size_t i = 0; i < enemies.size(); i++) {
-        Entity enemy = enemies.get_entity_at(i);
-
-        if (!positions.has_entity(enemy) || !colliders.has_entity(enemy))
-            continue;
-
-        Position& posE = positions[enemy];
-        const Collider& colE = colliders[enemy];
-
+    registry.view<Enemy, Position, Collider>().each([this](Enemy&, Position& posE, Collider& colE) {
         // Enemy hitbox in world coordinates (already in world coords, no conversion)
         float half_ew = colE.width * 0.5f;
         float half_eh = colE.height * 0.5f;
@@ -294,30 +264,14 @@ void CollisionSystem::update(Registry& registry, float dt)
         float e_top = posE.y - half_eh;
         float e_bottom = posE.y + half_eh;
 
-        for (size_t j = 0; j < walls.size(); j++) {
-            Entity wall = walls.get_entity_at(j);
-
-            if (!positions.has_entity(wall) || !colliders.has_entity(wall))
-                continue;
-
-            const Position& posW = positions[wall];
-            const Collider& colW = colliders[wall];
-
-            // Wall hitbox in world coordinates
-            float half_ww = colW.width * 0.5f;
-            float half_wh = colW.height * 0.5f;
-            float w_left = posW.x - half_ww;
-            float w_right = posW.x + half_ww;
-            float w_top = posW.y - half_wh;
-            float w_bottom = posW.y + half_wh;
-
+        for (const WallBox& wall : m_wallBoxes) {
             // AABB collision check
-            if (e_right > w_left && e_left < w_right && e_bottom > w_top && e_top < w_bottom) {
+            if (e_right > wall.left && e_left < wall.right && e_bottom > wall.top && e_top < wall.bottom) {
                 // Calculate penetration depths
-                float pen_left = e_right - w_left;
-                float pen_right = w_right - e_left;
-                float pen_top = e_bottom - w_top;
-                float pen_bottom = w_bottom - e_top;
+                float pen_left = e_right - wall.left;
+                float pen_right = wall.right - e_left;
+                float pen_top = e_bottom - wall.top;
+                float pen_bottom = wall.bottom - e_top;
 
                 // Find minimum penetration
                 float min_pen = pen_left;
@@ -336,23 +290,14 @@ void CollisionSystem::update(Registry& registry, float dt)
                 }
             }
         }
-
-    }
+    });
 
     // Collision Projectile vs Wall : Scroll-aware collision
     // Projectiles are in SCREEN coordinates, Walls are in WORLD coordinates
-    for (size_t i = 0; i < projectiles.size(); i++) {
-        Entity bullet = projectiles.get_entity_at(i);
-
+    registry.view<Projectile, Position, Collider>().each([this, &destroy_projectile](Entity bullet, Projectile& projectile, Position& posB, Collider& colB) {
         // Only player projectiles collide with walls
-        if (projectiles[bullet].faction != ProjectileFaction::Player)
-            continue;
-
-        if (!positions.has_entity(bullet) || !colliders.has_entity(bullet))
-            continue;
-
-        const Position& posB = positions[bullet];
-        const Collider& colB = colliders[bullet];
+        if (projectile.faction != ProjectileFaction::Player)
+            return;
 
         // Convert bullet SCREEN position to WORLD position
         float bullet_world_x = posB.x + m_currentScroll;
@@ -365,29 +310,15 @@ void CollisionSystem::update(Registry& registry, float dt)
         float b_top = posB.y - half_bh;
         float b_bottom = posB.y + half_bh;
 
-        for (size_t j = 0; j < walls.size(); j++) {
-            Entity wall = walls.get_entity_at(j);
-
-            if (!positions.has_entity(wall) || !colliders.has_entity(wall))
-                continue;
-
-            const Position& posW = positions[wall];
-            const Collider& colW = colliders[wall];
-
-            // Wall hitbox in world coordinates
-            float half_ww = colW.width * 0.5f;
-            float half_wh = colW.height * 0.5f;
-            float w_left = posW.x - half_ww;
-            float w_right = posW.x + half_ww;
-            float w_top = posW.y - half_wh;
-            float w_bottom = posW.y + half_wh;
-
+        for (const WallBox& wall : m_wallBoxes) {
             // AABB collision check
-            if (b_right > w_left && b_left < w_right && b_bottom > w_top && b_top < w_bottom) {
-                registry.add_component(bullet, ToDestroy{});
-                hide_projectile_sprite(bullet);
+            if (b_right > wall.left && b_left < wall.right && b_bottom > wall.top && b_top < wall.bottom) {
+                destroy_projectile(bullet);
                 break; // Bullet hit wall, no need to check more walls
             }
         }
-    }
+    });
+
+    // Point de synchronisation : le système peut aussi être appelé hors run_systems
+    registry.flush_commands();
 }
@@ -341,6 +341,10 @@ void HUDSystem::update(Registry& registry, float dt) {
         return;
     }
 
+    // Health and Score written since the previous update (see Registry::advance_change_tick)
+    uint32_t changedSince = m_lastChangeTick;
+    m_lastChangeTick = registry.advance_change_tick();
+
     // Find the LOCAL player entity
     // We need to find the entity that has the Score component, not just LocalPlayer/Controllable
     // because the Score might be on a different entity (the network entity)
@@ -420,10 +424,14 @@ void HUDSystem::update(Registry& registry, float dt) {
             // Keep violet color always
             healthBar.fillColor = engine::Color{150, 100, 255, 255};
 
-            // Update health text
-            if (uitexts.has_entity(m_healthTextEntity)) {
+            // Update health text (only when the shown health changed)
+            bool healthChanged = !m_healthTextValid || m_healthTextOwner != playerEntity
+                || healths.changed_tick(playerEntity) > changedSince;
+            if (healthChanged && uitexts.has_entity(m_healthTextEntity)) {
                 UIText& healthText = uitexts[m_healthTextEntity];
                 healthText.text = std::to_string(health.current) + " / " + std::to_string(health.max);
+                m_healthTextOwner = playerEntity;
+                m_healthTextValid = true;
             }
         } else {
             // Player is dead - animate health to 0
@@ -436,6 +444,7 @@ void HUDSystem::update(Registry& registry, float dt) {
                 UIText& healthText = uitexts[m_healthTextEntity];
                 healthText.text = "0 / 100";
             }
+            m_healthTextValid = false;
         }
     }
 
@@ -446,12 +455,19 @@ void HUDSystem::update(Registry& registry, float dt) {
 
     // Update score
     if (scores.has_entity(playerEntity) && uitexts.has_entity(m_scoreTextEntity)) {
-        const Score& score = scores[playerEntity];
-        UIText& scoreText = uitexts[m_scoreTextEntity];
-
-        std::stringstream ss;
-        ss << std::setw(8) << std::setfill('0') << score.value;
-        scoreText.text = ss.str();
+        bool scoreChanged = !m_scoreTextValid || m_scoreTextOwner != playerEntity
+            || scores.changed_tick(playerEntity) > changedSince;
+
+        if (scoreChanged) {
+            const Score& score = scores[playerEntity];
+            UIText& scoreText = uitexts[m_scoreTextEntity];
+
+            std::stringstream ss;
+            ss << std::setw(8) << std::setfill('0') << score.value;
+            scoreText.text = ss.str();
+            m_scoreTextOwner = playerEntity;
+            m_scoreTextValid = true;
+        }
     } else {
         // Debug: log why score isn't updating
         static bool logged = false;
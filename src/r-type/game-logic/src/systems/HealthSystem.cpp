@@ -32,6 +32,7 @@ void HealthSystem::init(Registry& registry)
             Health& health = healths[event.target];
             int oldHp = health.current;
             health.current -= event.damageAmount;
+            healths.touch(event.target);
 
             std::cout << "DamageEvent: Entity " << event.target
                       << " took " << event.damageAmount << " damage ("
@@ -173,6 +174,12 @@ void HealthSystem::update(Registry& registry, float dt)
     (void)dt;
 }
 
+void HealthSystem::declare_access(ecs::SystemAccess& access) const
+{
+    // update() est vide : les dégâts sont traités à la publication des DamageEvent
+    (void)access;
+}
+
 void HealthSystem::spawnBonusAtPosition(Registry& registry, BonusType type, float x, float y)
 {
     constexpr float BONUS_RADIUS = 40.0f;  // Rayon plus grand pour être visible
@@ -20,6 +20,15 @@
 LuaSystem::LuaSystem()
 {
     lua_.open_libraries(sol::lib::base, sol::lib::math, sol::lib::string, sol::lib::os);
+
+    Projectile projectile;
+    projectile.faction = ProjectileFaction::Enemy;
+    enemyProjectile_.with(Position{0.0f, 0.0f})
+        .with(Velocity{0.0f, 0.0f})
+        .with(projectile)
+        .with(Damage{})
+        .with(Collider{10.0f, 10.0f})
+        .with(NoFriction{});
 }
 
 void LuaSystem::init(Registry& registry)
@@ -71,50 +80,52 @@ void LuaSystem::bindComponents(Registry& registry)
     });
 }
 
+// Les projectiles des scripts sont créés pendant l'itération des boss et ennemis :
+// ils passent par le CommandBuffer du Registry, vidé après le LuaSystem. Une salve
+// est une seule commande, instanciée pool par pool depuis le prefab au vidage ;
+// aim(i, vel) remplit la vitesse du i-ème projectile et retourne son angle
+template <typename Aim>
+static void recordEnemyProjectiles(ecs::CommandBuffer& commands, const ecs::Prefab& prefab,
+    int count, float x, float y, int damage, float lifetime, Aim aim)
+{
+    if (count <= 0)
+        return;
+    commands.instantiate<Position, Velocity, Projectile, Damage>(prefab, static_cast<size_t>(count),
+        [=](size_t i, Entity, Position& pos, Velocity& vel, Projectile& projectile, Damage& dmg) mutable {
+            pos = Position{x, y};
+            projectile.angle = aim(i, vel);
+            projectile.lifetime = lifetime;
+            dmg.value = damage;
+        });
+}
+
 void LuaSystem::bindBossFunctions(Registry& registry)
 {
     std::cout << "[LuaSystem] Binding boss functions to Lua..." << std::endl;
 
     // Spawn a single boss projectile
-    lua_.set_function("spawn_boss_projectile", [&registry](float x, float y, float vx, float vy, int damage) {
-        Entity proj = registry.spawn_entity();
-        registry.add_component(proj, Position{x, y});
-        registry.add_component(proj, Velocity{vx, vy});
-
-        Projectile p;
-        p.faction = ProjectileFaction::Enemy;
-        p.lifetime = 10.0f;
-        registry.add_component(proj, p);
-        registry.add_component(proj, Damage{damage});
-        registry.add_component(proj, Collider{10.0f, 10.0f});
-        registry.add_component(proj, NoFriction{});
+    lua_.set_function("spawn_boss_projectile", [this, &registry](float x, float y, float vx, float vy, int damage) {
+        recordEnemyProjectiles(registry.commands(), enemyProjectile_, 1, x, y, damage, 10.0f,
+            [vx, vy](size_t, Velocity& vel) {
+                vel = Velocity{vx, vy};
+                return 0.0f;
+            });
     });
 
     // Spawn 360-degree spray pattern
-    lua_.set_function("spawn_pattern_360", [&registry](float x, float y, int count, float speed, int damage) {
+    lua_.set_function("spawn_pattern_360", [this, &registry](float x, float y, int count, float speed, int damage) {
         float angleStep = (2.0f * static_cast<float>(M_PI)) / static_cast<float>(count);
-        for (int i = 0; i < count; ++i) {
-            float angle = static_cast<float>(i) * angleStep;
-            float vx = std::cos(angle) * speed;
-            float vy = std::sin(angle) * speed;
-
-            Entity proj = registry.spawn_entity();
-            registry.add_component(proj, Position{x, y});
-            registry.add_component(proj, Velocity{vx, vy});
-
-            Projectile p;
-            p.faction = ProjectileFaction::Enemy;
-            p.lifetime = 8.0f;
-            p.angle = angle;
-            registry.add_component(proj, p);
-            registry.add_component(proj, Damage{damage});
-            registry.add_component(proj, Collider{10.0f, 10.0f});
-            registry.add_component(proj, NoFriction{});
-        }
+
+        recordEnemyProjectiles(registry.commands(), enemyProjectile_, count, x, y, damage, 8.0f,
+            [angleStep, speed](size_t i, Velocity& vel) {
+                float angle = static_cast<float>(i) * angleStep;
+                vel = Velocity{std::cos(angle) * speed, std::sin(angle) * speed};
+                return angle;
+            });
     });
 
     // Spawn aimed burst pattern toward nearest player
-    lua_.set_function("spawn_pattern_aimed", [&registry](float x, float y, int count, float speed, int damage, float spreadAngle) {
+    lua_.set_function("spawn_pattern_aimed", [this, &registry](float x, float y, int count, float speed, int damage, float spreadAngle) {
         // Find nearest player
         float targetX = x - 500.0f;  // Default: aim left
         float targetY = y;
@@ -146,75 +157,39 @@ void LuaSystem::bindBossFunctions(Registry& registry)
         float startAngle = baseAngle - spreadRad / 2.0f;
         float angleStep = (count > 1) ? spreadRad / static_cast<float>(count - 1) : 0.0f;
 
-        for (int i = 0; i < count; ++i) {
-            float angle = startAngle + static_cast<float>(i) * angleStep;
-            float vx = std::cos(angle) * speed;
-            float vy = std::sin(angle) * speed;
-
-            Entity proj = registry.spawn_entity();
-            registry.add_component(proj, Position{x, y});
-            registry.add_component(proj, Velocity{vx, vy});
-
-            Projectile p;
-            p.faction = ProjectileFaction::Enemy;
-            p.lifetime = 8.0f;
-            p.angle = angle;
-            registry.add_component(proj, p);
-            registry.add_component(proj, Damage{damage});
-            registry.add_component(proj, Collider{10.0f, 10.0f});
-            registry.add_component(proj, NoFriction{});
-        }
+        recordEnemyProjectiles(registry.commands(), enemyProjectile_, count, x, y, damage, 8.0f,
+            [startAngle, angleStep, speed](size_t i, Velocity& vel) {
+                float angle = startAngle + static_cast<float>(i) * angleStep;
+                vel = Velocity{std::cos(angle) * speed, std::sin(angle) * speed};
+                return angle;
+            });
     });
 
     // Spawn spiral pattern with rotation offset
-    lua_.set_function("spawn_pattern_spiral", [&registry](float x, float y, int count, float speed, int damage, float rotationOffset) {
+    lua_.set_function("spawn_pattern_spiral", [this, &registry](float x, float y, int count, float speed, int damage, float rotationOffset) {
         float rotationRad = rotationOffset * static_cast<float>(M_PI) / 180.0f;
         float angleStep = (2.0f * static_cast<float>(M_PI)) / static_cast<float>(count);
 
-        for (int i = 0; i < count; ++i) {
-            float angle = rotationRad + static_cast<float>(i) * angleStep;
-            float vx = std::cos(angle) * speed;
-            float vy = std::sin(angle) * speed;
-
-            Entity proj = registry.spawn_entity();
-            registry.add_component(proj, Position{x, y});
-            registry.add_component(proj, Velocity{vx, vy});
-
-            Projectile p;
-            p.faction = ProjectileFaction::Enemy;
-            p.lifetime = 8.0f;
-            p.angle = angle;
-            registry.add_component(proj, p);
-            registry.add_component(proj, Damage{damage});
-            registry.add_component(proj, Collider{10.0f, 10.0f});
-            registry.add_component(proj, NoFriction{});
-        }
+        recordEnemyProjectiles(registry.commands(), enemyProjectile_, count, x, y, damage, 8.0f,
+            [rotationRad, angleStep, speed](size_t i, Velocity& vel) {
+                float angle = rotationRad + static_cast<float>(i) * angleStep;
+                vel = Velocity{std::cos(angle) * speed, std::sin(angle) * speed};
+                return angle;
+            });
     });
 
     // Spawn random barrage pattern
-    lua_.set_function("spawn_pattern_random", [&registry](float x, float y, int count, float speed, int damage) {
-        for (int i = 0; i < count; ++i) {
-            // Random angle between 0 and 2*PI
-            float angle = (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)) * 2.0f * static_cast<float>(M_PI);
-            // Slight speed variation
-            float speedVar = speed * (0.8f + (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)) * 0.4f);
-
-            float vx = std::cos(angle) * speedVar;
-            float vy = std::sin(angle) * speedVar;
-
-            Entity proj = registry.spawn_entity();
-            registry.add_component(proj, Position{x, y});
-            registry.add_component(proj, Velocity{vx, vy});
-
-            Projectile p;
-            p.faction = ProjectileFaction::Enemy;
-            p.lifetime = 8.0f;
-            p.angle = angle;
-            registry.add_component(proj, p);
-            registry.add_component(proj, Damage{damage});
-            registry.add_component(proj, Collider{10.0f, 10.0f});
-            registry.add_component(proj, NoFriction{});
-        }
+    lua_.set_function("spawn_pattern_random", [this, &registry](float x, float y, int count, float speed, int damage) {
+        recordEnemyProjectiles(registry.commands(), enemyProjectile_, count, x, y, damage, 8.0f,
+            [speed](size_t, Velocity& vel) {
+                // Random angle between 0 and 2*PI
+                float angle = (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)) * 2.0f * static_cast<float>(M_PI);
+                // Slight speed variation
+                float speedVar = speed * (0.8f + (static_cast<float>(rand()) / static_cast<float>(RAND_MAX)) * 0.4f);
+
+                vel = Velocity{std::cos(angle) * speedVar, std::sin(angle) * speedVar};
+                return angle;
+            });
     });
 }
 
@@ -237,21 +212,8 @@ void LuaSystem::updateEnemyScripts(Registry& registry, float dt)
 {
     if (!registry.has_component_registered<Script>()) return;
 
-    auto& scripts = registry.get_components<Script>();
-    auto& positions = registry.get_components<Position>();
-    auto& velocities = registry.get_components<Velocity>();
-
-    for (size_t i = 0; i < scripts.size(); ++i) {
-        Entity entity = scripts.get_entity_at(i);
-
-        if (!positions.has_entity(entity) || !velocities.has_entity(entity))
-            continue;
-
-        auto& script = scripts.get_data_at(i);
-        auto& pos = positions[entity];
-        auto& vel = velocities[entity];
-
-        if (script.path.empty()) continue;
+    registry.view<Script, Position, Velocity>().each([this, dt](Script& script, Position& pos, Velocity& vel) {
+        if (script.path.empty()) return;
 
         // Load script if not cached
         if (scriptCache_.find(script.path) == scriptCache_.end()) {
@@ -265,7 +227,7 @@ void LuaSystem::updateEnemyScripts(Registry& registry, float dt)
             if (!loadRes.valid()) {
                 sol::error err = loadRes;
                 std::cerr << "Failed to load script: " << script.path << " Error: " << err.what() << std::endl;
-                continue;
+                return;
             }
 
             sol::protected_function scriptFunc = loadRes;
@@ -273,14 +235,14 @@ void LuaSystem::updateEnemyScripts(Registry& registry, float dt)
             if (!result.valid()) {
                 sol::error err = result;
                 std::cerr << "Failed to execute script body: " << script.path << " Error: " << err.what() << std::endl;
-                continue;
+                return;
             }
 
             if (result.get_type() == sol::type::function) {
                 scriptCache_[script.path] = result;
             } else {
                 std::cerr << "Script must return a function: " << script.path << std::endl;
-                continue;
+                return;
             }
         }
 
@@ -306,7 +268,7 @@ void LuaSystem::updateEnemyScripts(Registry& registry, float dt)
                 vel.y = velTable.get_or("y", vel.y);
             }
         }
-    }
+    });
 }
 
 void LuaSystem::updateBossScripts(Registry& registry, float dt)
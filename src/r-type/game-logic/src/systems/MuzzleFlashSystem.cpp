@@ -8,6 +8,7 @@
 #include "systems/MuzzleFlashSystem.hpp"
 #include "ecs/events/GameEvents.hpp"
 #include <iostream>
+#include <vector>
 
 MuzzleFlashSystem::MuzzleFlashSystem(engine::IGraphicsPlugin* graphics)
     : graphics_(graphics)
@@ -23,7 +24,7 @@ void MuzzleFlashSystem::init(Registry& registry)
     // Subscribe to muzzle flash spawn events
     spawnSubId_ = eventBus.subscribe<ecs::MuzzleFlashSpawnEvent>(
         [this, &registry](const ecs::MuzzleFlashSpawnEvent& event) {
-            if (!hasActiveMuzzleFlash(event.shooter)) {
+            if (!hasActiveMuzzleFlash(registry, event.shooter)) {
                 spawnMuzzleFlash(registry, event.shooter, event.isCompanion, event.isEnemy, event.shooterWidth);
             }
         }
@@ -50,27 +51,11 @@ void MuzzleFlashSystem::init(Registry& registry)
                 }
             }
 
-            // Fallback: Check the muzzle flash's Attached component to find ones attached to companion
-            // The muzzle flash is attached to the companion, and companion was attached to player
-            auto& attacheds = registry.get_components<Attached>();
-            std::vector<Entity> toDestroy;
-
-            for (const auto& [shooter, flash] : shooterToFlash_) {
-                // Check if the muzzle flash entity is attached to a shooter that was attached to this player
-                // Since companion might already be destroyed, check if the flash's parent (shooter) is attached to player
-                if (attacheds.has_entity(shooter)) {
-                    if (attacheds[shooter].parentEntity == event.player) {
-                        toDestroy.push_back(shooter);
-                    }
-                }
-                // Also check if the muzzle flash itself is orphaned (its parent shooter no longer exists)
-                else if (attacheds.has_entity(flash)) {
-                    toDestroy.push_back(shooter);
-                }
-            }
-
-            for (Entity shooter : toDestroy) {
-                destroyMuzzleFlash(registry, shooter);
+            // Fallback: the companion is still attached to the player, its flash is attached to it
+            std::vector<Entity> children;
+            registry.each_child(event.player, [&children](Entity child) { children.push_back(child); });
+            for (Entity child : children) {
+                destroyMuzzleFlash(registry, child);
             }
         }
     );
@@ -81,33 +66,19 @@ void MuzzleFlashSystem::update(Registry& registry, float dt)
     auto& shotAnimations = registry.get_components<ShotAnimation>();
     auto& sprites = registry.get_components<Sprite>();
     auto& positions = registry.get_components<Position>();
+    std::vector<Entity> orphans;
+    std::vector<Entity> expired;
 
-    // Clean up destroyed flash entities and orphaned flashes (shooter no longer exists)
-    std::vector<Entity> toRemove;
-    std::vector<Entity> toDestroy;
-    for (const auto& [shooter, flash] : shooterToFlash_) {
-        if (!shotAnimations.has_entity(flash)) {
-            toRemove.push_back(shooter);
-        }
-        // Check if shooter (parent) still exists - if not, destroy the muzzle flash
-        else if (!positions.has_entity(shooter)) {
-            toDestroy.push_back(shooter);
-        }
-    }
-    for (Entity shooter : toRemove) {
-        shooterToFlash_.erase(shooter);
-    }
-    // Destroy orphaned muzzle flashes
-    for (Entity shooter : toDestroy) {
-        destroyMuzzleFlash(registry, shooter);
-    }
-
-    // Update all shot animations
+    // Every flash is a child of its shooter: one sweep animates them and finds the
+    // orphans (shooter killed, which drops the link, or without position)
     for (size_t i = 0; i < shotAnimations.size(); i++) {
         Entity entity = shotAnimations.get_entity_at(i);
+        Entity shooter = registry.parent_of(entity);
 
-        if (!shotAnimations.has_entity(entity))
+        if (shooter == ecs::Hierarchy::NONE || !positions.has_entity(shooter)) {
+            orphans.push_back(entity);
             continue;
+        }
 
         auto& shotAnim = shotAnimations[entity];
         shotAnim.timer += dt;
@@ -133,22 +104,21 @@ void MuzzleFlashSystem::update(Registry& registry, float dt)
 
         // Destroy the muzzle flash effect after 0.3 second (unless persistent)
         if (!shotAnim.persistent && shotAnim.lifetime >= 0.3f) {
-            // Find and remove from tracking map
-            for (auto it = shooterToFlash_.begin(); it != shooterToFlash_.end(); ++it) {
-                if (it->second == entity) {
-                    shooterToFlash_.erase(it);
-                    break;
-                }
-            }
-            registry.kill_entity(entity);
+            expired.push_back(entity);
         }
     }
+    // Destroy orphaned muzzle flashes
+    for (Entity flash : orphans) {
+        removeMuzzleFlash(registry, flash);
+    }
+    for (Entity flash : expired) {
+        registry.kill_entity(flash);
+    }
 }
 
 void MuzzleFlashSystem::shutdown()
 {
     std::cout << "MuzzleFlashSystem: Arrêt" << std::endl;
-    shooterToFlash_.clear();
 }
 
 void MuzzleFlashSystem::spawnMuzzleFlash(Registry& registry, Entity shooter, bool isCompanion, bool isEnemy, float shooterWidth)
@@ -187,6 +157,8 @@ void MuzzleFlashSystem::spawnMuzzleFlash(Registry& registry, Entity shooter, boo
         flashOffsetY,
         0.0f  // No smooth follow for muzzle flash
     });
+    // The flash is found back as the shooter's child (also set by AttachmentSystem)
+    registry.set_parent(muzzleFlash, shooter);
 
     // Add Sprite component
     float size = isCompanion ? 30.0f : 40.0f;
@@ -210,20 +182,19 @@ void MuzzleFlashSystem::spawnMuzzleFlash(Registry& registry, Entity shooter, boo
     // For players: persistent = false
     bool persistent = isCompanion && !isEnemy;
     registry.add_component(muzzleFlash, ShotAnimation{0.0f, 0.0f, 0.1f, false, persistent});
-
-    // Track this muzzle flash
-    shooterToFlash_[shooter] = muzzleFlash;
 }
 
 void MuzzleFlashSystem::destroyMuzzleFlash(Registry& registry, Entity shooter)
 {
-    auto it = shooterToFlash_.find(shooter);
-    if (it == shooterToFlash_.end()) {
-        return;
-    }
+    Entity flashEntity = findMuzzleFlash(registry, shooter);
 
-    Entity flashEntity = it->second;
+    if (flashEntity != ecs::Hierarchy::NONE) {
+        removeMuzzleFlash(registry, flashEntity);
+    }
+}
 
+void MuzzleFlashSystem::removeMuzzleFlash(Registry& registry, Entity flashEntity)
+{
     // Remove rendering components first to stop display immediately
     auto& sprites = registry.get_components<Sprite>();
     auto& positions = registry.get_components<Position>();
@@ -238,17 +209,28 @@ void MuzzleFlashSystem::destroyMuzzleFlash(Registry& registry, Entity shooter)
         registry.remove_component<Attached>(flashEntity);
     if (shotAnims.has_entity(flashEntity))
         registry.remove_component<ShotAnimation>(flashEntity);
+    registry.set_parent(flashEntity, ecs::Hierarchy::NONE);
 
     // Mark for destruction via ECS
     auto& toDestroys = registry.get_components<ToDestroy>();
     if (!toDestroys.has_entity(flashEntity)) {
         registry.add_component(flashEntity, ToDestroy{});
     }
+}
 
-    shooterToFlash_.erase(it);
+Entity MuzzleFlashSystem::findMuzzleFlash(Registry& registry, Entity shooter) const
+{
+    auto& shotAnims = registry.get_components<ShotAnimation>();
+    Entity flash = ecs::Hierarchy::NONE;
+
+    registry.each_child(shooter, [&](Entity child) {
+        if (flash == ecs::Hierarchy::NONE && shotAnims.has_entity(child))
+            flash = child;
+    });
+    return flash;
 }
 
-bool MuzzleFlashSystem::hasActiveMuzzleFlash(Entity shooter) const
+bool MuzzleFlashSystem::hasActiveMuzzleFlash(Registry& registry, Entity shooter) const
 {
-    return shooterToFlash_.find(shooter) != shooterToFlash_.end();
+    return findMuzzleFlash(registry, shooter) != ecs::Hierarchy::NONE;
 }
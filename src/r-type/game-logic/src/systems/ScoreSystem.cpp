@@ -27,6 +27,7 @@ void ScoreSystem::init(Registry& registry)
                 Score& score = scores[event.killer];
                 int old_score = score.value;
                 score.value += event.scoreValue;
+                scores.touch(event.killer);
                 std::cout << "[ScoreSystem] Enemy killed by entity " << event.killer
                           << "! Score: " << old_score << " -> " << score.value << std::endl;
             } else {
@@ -48,3 +49,9 @@ void ScoreSystem::update(Registry& registry, float dt)
     (void)dt;
     // Le score est mis à jour via les événements, pas dans update
 }
+
+void ScoreSystem::declare_access(ecs::SystemAccess& access) const
+{
+    // Aucun accès dans update() : peut tourner en parallèle de n'importe quel système
+    (void)access;
+}
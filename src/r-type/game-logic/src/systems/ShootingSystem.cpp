@@ -371,6 +371,7 @@ void ShootingSystem::updateLaserBeam(Registry& registry, Entity shooter, const P
                     // Appliquer les dégâts
                     if (healths.has_entity(enemy)) {
                         healths[enemy].current -= static_cast<int>(beam.damage_per_tick);
+                        healths.touch(enemy);
                         if (healths[enemy].current <= 0) {
                             registry.add_component(enemy, ToDestroy{});
                             // Publier l'événement pour le score (100 points par défaut)
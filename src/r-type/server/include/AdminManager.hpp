@@ -41,6 +41,7 @@ private:
     CommandResult cmd_list(const std::vector<std::string>& args);
     CommandResult cmd_kick(const std::vector<std::string>& args);
     CommandResult cmd_info(const std::vector<std::string>& args);
+    CommandResult cmd_profile(const std::vector<std::string>& args);
 
     // Tier 2 - Game control commands
     CommandResult cmd_pause(const std::vector<std::string>& args);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <unordered_map>
 #include <vector>
 #include <cstdint>
@@ -179,9 +180,15 @@ private:
     protocol::Difficulty difficulty_;
     uint16_t map_id_;
     std::atomic<bool> is_active_;
+    // Systems are disabled in the Registry while paused; this gates the session-level logic
     bool is_paused_ = false;
 
+    // Arène des pools du registry (déclarée avant lui : elle doit lui survivre).
+    // Non synchronisée : une session n'est tickée que par un worker à la fois
+    std::pmr::unsynchronized_pool_resource arena_;
     Registry registry_;
+    // Composants communs à tous les ennemis, stats fixées par on_spawn_enemy
+    ecs::Prefab enemy_prefab_;
     std::unordered_map<uint32_t, GamePlayer> players_;
     std::unordered_map<uint32_t, Entity> player_entities_;
     WaveManager wave_manager_;
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <atomic>
 #include <mutex>
+#include <optional>
 
 #include "plugin_manager/INetworkPlugin.hpp"
 #include "plugin_manager/PluginManager.hpp"
@@ -28,6 +29,8 @@
 #include "protocol/Payloads.hpp"
 
 #include "interfaces/INetworkListener.hpp"
+#include "ecs/SystemProfiler.hpp"
+#include "core/TickScheduler.hpp"
 #include "interfaces/ILobbyListener.hpp"
 #include "interfaces/IGameSessionListener.hpp"
 
@@ -81,12 +84,19 @@ public:
         uint32_t connected_players;
         uint32_t active_sessions;
         uint32_t total_connections;
+        core::TickStats ticks;
     };
 
     std::vector<AdminPlayerInfo> get_connected_players() const;
     bool kick_player(uint32_t player_id, const std::string& reason);
     ServerStats get_server_stats() const;
 
+    /**
+     * @brief Per-system tick cost of a game session (see Registry::system_profile)
+     * @return std::nullopt if the session does not exist
+     */
+    std::optional<std::vector<ecs::SystemProfile>> get_session_profile(uint32_t session_id);
+
     // Tier 2 - Game control methods
     uint32_t pause_all_sessions();
     uint32_t resume_all_sessions();
@@ -172,6 +182,8 @@ private:
     std::unique_ptr<GlobalLeaderboardManager> global_leaderboard_manager_;
     std::chrono::steady_clock::time_point server_start_time_;
     uint32_t total_connections_;
+    // Cadence de run() : pas fixe de 1/SERVER_TICK_RATE s sur échéances absolues
+    core::TickScheduler tick_scheduler_{config::SERVER_TICK_RATE};
 };
 
 }
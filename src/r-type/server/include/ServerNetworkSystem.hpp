@@ -24,6 +24,22 @@
 
 namespace rtype::server {
 
+/**
+ * @brief Player input received by the network thread
+ *
+ * Published with EventBus::publish_concurrent() so that it reaches the
+ * session without a lock; delivered when the session drains its deferred
+ * events at the start of the tick.
+ */
+struct ClientInputEvent : public core::Event {
+    uint32_t player_id;
+    protocol::ClientInputPayload input;
+
+    ClientInputEvent(uint32_t id, const protocol::ClientInputPayload& payload)
+        : player_id(id)
+        , input(payload) {}
+};
+
 /**
  * @brief ECS System for server-side network synchronization
  *
@@ -67,7 +83,7 @@ public:
     void shutdown() override;
 
     /**
-     * @brief Queue a player input for processing
+     * @brief Queue a player input for processing (session thread only, see ClientInputEvent)
      */
     void queue_input(uint32_t player_id, const protocol::ClientInputPayload& input);
 
@@ -224,6 +240,7 @@ private:
     core::EventBus::SubscriptionId enemyKilledSubId_;
     core::EventBus::SubscriptionId explosionSubId_;
     core::EventBus::SubscriptionId bonusCollectedSubId_;
+    core::EventBus::SubscriptionId clientInputSubId_;
 
     std::unordered_map<uint32_t, Entity>* player_entities_ = nullptr;
 
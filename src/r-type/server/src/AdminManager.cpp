@@ -1,6 +1,7 @@
 #include "AdminManager.hpp"
 #include "Server.hpp"
 #include <sstream>
+#include <iomanip>
 #include <algorithm>
 #include <iostream>
 
@@ -24,6 +25,7 @@ void AdminManager::register_commands()
     commands_["list"] = [this](const auto& args) { return cmd_list(args); };
     commands_["kick"] = [this](const auto& args) { return cmd_kick(args); };
     commands_["info"] = [this](const auto& args) { return cmd_info(args); };
+    commands_["profile"] = [this](const auto& args) { return cmd_profile(args); };
     commands_["pause"] = [this](const auto& args) { return cmd_pause(args); };
     commands_["resume"] = [this](const auto& args) { return cmd_resume(args); };
     commands_["clearenemies"] = [this](const auto& args) { return cmd_clear_enemies(args); };
@@ -69,6 +71,7 @@ AdminManager::CommandResult AdminManager::cmd_help(const std::vector<std::string
         << "  list                 - List connected players\n"
         << "  kick <player_id>     - Kick a player\n"
         << "  info                 - Server statistics\n"
+        << "  profile <sid> [n]    - Top n systems by tick cost in a session\n"
         << "\n"
         << "Tier 2 - Game Control:\n"
         << "  pause                - Pause all game sessions\n"
@@ -129,7 +132,48 @@ AdminManager::CommandResult AdminManager::cmd_info(const std::vector<std::string
         << "  Uptime: " << stats.uptime_seconds << "s\n"
         << "  Connected Players: " << stats.connected_players << "\n"
         << "  Active Sessions: " << stats.active_sessions << "\n"
-        << "  Total Connections: " << stats.total_connections;
+        << "  Total Connections: " << stats.total_connections << "\n"
+        << "  Ticks: " << stats.ticks.ticks << " (overruns: " << stats.ticks.overruns
+        << ", late starts: " << stats.ticks.late_starts << ", dropped: " << stats.ticks.dropped << ")";
+    return {true, oss.str()};
+}
+
+AdminManager::CommandResult AdminManager::cmd_profile(const std::vector<std::string>& args)
+{
+    if (args.empty())
+        return {false, "Usage: profile <session_id> [count]"};
+    uint32_t session_id;
+    size_t count = 5;
+
+    try {
+        session_id = std::stoul(args[0]);
+        if (args.size() > 1)
+            count = std::stoul(args[1]);
+    } catch (...) {
+        return {false, "Invalid argument: usage is profile <session_id> [count]"};
+    }
+    auto profile = server_->get_session_profile(session_id);
+    if (!profile)
+        return {false, "Session " + std::to_string(session_id) + " not found"};
+    std::sort(profile->begin(), profile->end(), [](const auto& a, const auto& b) {
+        return a.total_ms > b.total_ms;
+    });
+    count = std::min(count, profile->size());
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(1)
+        << "Session " << session_id << " - top " << count << " system(s) by tick cost"
+        << " (us: mean / p50 / p95 / p99 / max):\n";
+    for (size_t i = 0; i < count; ++i) {
+        const auto& sys = (*profile)[i];
+        oss << "  " << sys.name << (sys.enabled ? "" : " [disabled]") << ": "
+            << sys.mean_us << " / " << sys.p50_us << " / " << sys.p95_us << " / "
+            << sys.p99_us << " / " << sys.max_us
+            << ", " << sys.total_ms << " ms over " << sys.samples << " ticks";
+        if (sys.entities > 0)
+            oss << ", " << sys.entities << " entities";
+        oss << "\n";
+    }
     return {true, oss.str()};
 }
 
@@ -64,6 +64,7 @@ GameSession::GameSession(uint32_t session_id, protocol::GameMode game_mode,
     , difficulty_(difficulty)
     , map_id_(map_id)
     , is_active_(true)
+    , registry_(&arena_)
     , tick_count_(0)
     , current_scroll_(0.0)
     , scroll_speed_(config::GAME_SCROLL_SPEED)
@@ -132,6 +133,19 @@ GameSession::GameSession(uint32_t session_id, protocol::GameMode game_mode,
     registry_.register_component<game::ScrollState>();
     registry_.register_component<NetworkPlayerId>();  // For network sync of shield broken etc.
 
+    // Position/Velocity are co-iterated by physics and the snapshot serializer:
+    // keep their dense arrays aligned from the start
+    registry_.group<Position, Velocity>();
+
+    enemy_prefab_.with(Position{0.0f, 0.0f})
+        .with(Velocity{0.0f, 0.0f})
+        .with(Health{})
+        .with(AI{})
+        .with(Script{})
+        .with(Enemy{})
+        .with(NoFriction{})
+        .with(Collider{});
+
     registry_.register_system<MovementSystem>();
     registry_.register_system<PhysiqueSystem>();
     registry_.register_system<AttachmentSystem>();
@@ -521,8 +535,8 @@ void GameSession::remove_player(uint32_t player_id)
 
 void GameSession::handle_input(uint32_t player_id, const protocol::ClientInputPayload& input)
 {
-    if (network_system_)
-        network_system_->queue_input(player_id, input);
+    // Called from the network thread: hand over through the lock-free queue
+    registry_.get_event_bus().publish_concurrent(ClientInputEvent(player_id, input));
 }
 
 void GameSession::update(float delta_time)
@@ -530,9 +544,12 @@ void GameSession::update(float delta_time)
     if (!is_active_)
         return;
 
+    // Inputs (and any other deferred events) reach the session here
+    registry_.get_event_bus().process_deferred();
+
+    // Paused: every system but the network one is disabled (see pause())
     if (is_paused_) {
-        if (network_system_)
-            network_system_->update(registry_, delta_time);
+        registry_.run_systems(delta_time);
         return;
     }
 
@@ -572,8 +589,8 @@ void GameSession::update(float delta_time)
     wave_manager_.update(delta_time, current_scroll_);
 
     // Update checkpoint system (handles respawn timers)
-    if (registry_.has_system<game::CheckpointSystem>()) {
-        registry_.get_system<game::CheckpointSystem>().update(registry_, delta_time);
+    if (auto* checkpoint_system = registry_.find_system<game::CheckpointSystem>()) {
+        checkpoint_system->update(registry_, delta_time);
     }
 
     check_offscreen_enemies();
@@ -648,7 +665,7 @@ void GameSession::update(float delta_time)
             boss_script.attack_timer = 0.0f;
             boss_script.phase_timer = 0.0f;
             boss_script.current_phase = 0;
-            registry_.add_component(boss_entity, boss_script);
+            registry_.add_component(boss_entity, std::move(boss_script));
 
             // Add BossPhase component for phase management
             game::BossPhase boss_phase;
@@ -667,7 +684,7 @@ void GameSession::update(float delta_time)
                 boss_phase.movement_pattern = first_phase.movement_pattern;
                 boss_phase.movement_speed_multiplier = first_phase.movement_speed_multiplier;
             }
-            registry_.add_component(boss_entity, boss_phase);
+            registry_.add_component(boss_entity, std::move(boss_phase));
 
             // Update level controller
             lc.boss_spawned = true;
@@ -816,6 +833,7 @@ void GameSession::update(float delta_time)
                         Entity player_entity = players_[pl.player_id].entity;
                         if (healths.has_entity(player_entity)) {
                             healths[player_entity].current = healths[player_entity].max;
+                            healths.touch(player_entity);
                         }
                         if (bonus_speeds.has_entity(player_entity)) {
                             registry_.remove_component<SpeedBoost>(player_entity);
@@ -1111,30 +1129,12 @@ void GameSession::on_spawn_enemy(const std::string& enemy_type, float x, float y
     int scaled_health = static_cast<int>(static_cast<float>(stats.health) * health_mult);
     float scaled_velocity = stats.velocity_x * speed_mult;
 
-    Entity enemy = registry_.spawn_entity();
     float center_x = x + stats.width / 2.0f;
     float center_y = y + stats.height / 2.0f;
 
-    registry_.add_component(enemy, Position{center_x, center_y});
-    registry_.add_component(enemy, Velocity{scaled_velocity, 0.0f});
-    registry_.add_component(enemy, Health{scaled_health, scaled_health});
-
-    // Add AI component for enemy type detection in snapshots
-    AI ai;
-    ai.type = stats.ai_type;
-    ai.moveSpeed = std::abs(scaled_velocity);  // Use scaled speed
-    registry_.add_component(enemy, ai);
-
     // Initialize Level Manager with index
     level_manager_.load_level_index(assets::paths::MAPS_INDEX);
 
-    // Lua System Initegration
-    Script script;
-    if (enemy_scripts_.find(enemy_type) != enemy_scripts_.end()) {
-        script.path = enemy_scripts_[enemy_type];
-    }
-    registry_.add_component(enemy, script);
-
     // Convert BonusDropConfig to BonusDrop component
     BonusDrop drop;
     drop.enabled = bonus_drop.enabled;
@@ -1149,9 +1149,25 @@ void GameSession::on_spawn_enemy(const std::string& enemy_type, float x, float y
         drop.bonusType = BonusType::BONUS_WEAPON;
     }
 
-    registry_.add_component(enemy, Enemy{drop});
-    registry_.add_component(enemy, NoFriction{});
-    registry_.add_component(enemy, Collider{stats.width, stats.height});
+    // Tous les composants de l'ennemi en une instanciation du prefab
+    Entity enemy = 0;
+    registry_.instantiate<Position, Velocity, Health, AI, Script, Enemy, Collider>(enemy_prefab_, 1,
+        [&](size_t, Entity spawned, Position& pos, Velocity& vel, Health& health, AI& ai,
+            Script& script, Enemy& tag, Collider& collider) {
+            enemy = spawned;
+            pos = Position{center_x, center_y};
+            vel = Velocity{scaled_velocity, 0.0f};
+            health = Health{scaled_health, scaled_health};
+            // AI type is used for enemy type detection in snapshots
+            ai.type = stats.ai_type;
+            ai.moveSpeed = std::abs(scaled_velocity);  // Use scaled speed
+            // Lua System Initegration
+            auto script_it = enemy_scripts_.find(enemy_type);
+            if (script_it != enemy_scripts_.end())
+                script.path = script_it->second;
+            tag = Enemy{drop};
+            collider = Collider{stats.width, stats.height};
+        });
 
     // Add Kamikaze tag for kamikaze enemies
     if (enemy_type == "kamikaze") {
@@ -1703,12 +1719,16 @@ Entity GameSession::respawn_player_at(uint32_t player_id, float x, float y, floa
 
 void GameSession::pause()
 {
+    // Systems keep their state; only the network one keeps running for snapshots
+    registry_.set_all_systems_enabled(false);
+    registry_.set_system_enabled<ServerNetworkSystem>(true);
     is_paused_ = true;
     std::cout << "[GameSession " << session_id_ << "] Paused\n";
 }
 
 void GameSession::resume()
 {
+    registry_.set_all_systems_enabled(true);
     is_paused_ = false;
     std::cout << "[GameSession " << session_id_ << "] Resumed\n";
 }
@@ -121,26 +121,25 @@ void Server::run()
         std::cerr << "[Server] Cannot run - server not started\n";
         return;
     }
-    const auto tick_duration = std::chrono::milliseconds(config::TICK_INTERVAL_MS);
-    auto last_tick_time = std::chrono::steady_clock::now();
+    tick_scheduler_.reset();
     std::cout << "[Server] Running at " << config::SERVER_TICK_RATE << " TPS (tick interval: "
-              << config::TICK_INTERVAL_MS << "ms)\n";
+              << tick_scheduler_.step_seconds() * 1000.0f << "ms)\n";
     while (running_) {
-        auto tick_start = std::chrono::steady_clock::now();
-        auto delta = std::chrono::duration_cast<std::chrono::microseconds>(tick_start - last_tick_time);
-        float delta_time = delta.count() / 1000000.0f;
-        last_tick_time = tick_start;
+        // Pas fixe : en retard, les sessions rattrapent les ticks manqués (4 au plus)
+        uint32_t steps = tick_scheduler_.wait();
+        float delta_time = tick_scheduler_.step_seconds();
+
         network_handler_->process_packets();
         lobby_manager_.update();
         room_manager_.update();
-        session_manager_->update_all(delta_time);
+        for (uint32_t i = 0; i < steps; i++)
+            session_manager_->update_all(delta_time);
         broadcast_all_session_events();
         session_manager_->cleanup_inactive_sessions();
-        auto tick_end = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(tick_end - tick_start);
-        if (elapsed < tick_duration)
-            std::this_thread::sleep_for(tick_duration - elapsed);
     }
+    core::TickStats stats = tick_scheduler_.stats();
+    std::cout << "[Server] Loop stopped after " << stats.ticks << " ticks (" << stats.overruns
+              << " overruns, " << stats.late_starts << " late starts, " << stats.dropped << " dropped)\n";
 }
 
 void Server::on_client_connect(uint32_t client_id, const protocol::ClientConnectPayload& payload)
@@ -1125,10 +1124,20 @@ Server::ServerStats Server::get_server_stats() const
         static_cast<uint32_t>(uptime),
         static_cast<uint32_t>(connected_clients_.size()),
         static_cast<uint32_t>(session_ids.size()),
-        total_connections_
+        total_connections_,
+        tick_scheduler_.stats()
     };
 }
 
+std::optional<std::vector<ecs::SystemProfile>> Server::get_session_profile(uint32_t session_id)
+{
+    auto* session = session_manager_->get_session(session_id);
+
+    if (!session)
+        return std::nullopt;
+    return session->get_registry().system_profile();
+}
+
 uint32_t Server::pause_all_sessions()
 {
     uint32_t count = 0;
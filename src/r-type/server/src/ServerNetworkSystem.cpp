@@ -46,8 +46,8 @@ void ServerNetworkSystem::init(Registry& registry)
             const auto& vel = velocities[event.projectile];
             const auto& pos = positions[event.projectile];
             protocol::ServerProjectileSpawnPayload spawn;
-            spawn.projectile_id = ByteOrder::host_to_net32(event.projectile);
-            spawn.owner_id = ByteOrder::host_to_net32(event.shooter);
+            spawn.projectile_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(event.projectile));
+            spawn.owner_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(event.shooter));
             spawn.projectile_type = protocol::ProjectileType::BULLET;
             spawn.spawn_x = pos.x;
             spawn.spawn_y = pos.y;
@@ -81,7 +81,7 @@ void ServerNetworkSystem::init(Registry& registry)
 
             protocol::ServerScoreUpdatePayload score_update;
             score_update.player_id = ByteOrder::host_to_net32(killer_player_id);
-            score_update.entity_id = ByteOrder::host_to_net32(static_cast<uint32_t>(event.killer));
+            score_update.entity_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(event.killer));
             score_update.score_delta = ByteOrder::host_to_net32(event.scoreValue);
             score_update.new_total_score = ByteOrder::host_to_net32(killer_score);
             {
@@ -93,7 +93,7 @@ void ServerNetworkSystem::init(Registry& registry)
     explosionSubId_ = registry.get_event_bus().subscribe<ecs::ExplosionEvent>(
         [this](const ecs::ExplosionEvent& event) {
             protocol::ServerExplosionPayload payload;
-            payload.source_entity_id = ByteOrder::host_to_net32(static_cast<uint32_t>(event.source));
+            payload.source_entity_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(event.source));
             payload.position_x = event.x;
             payload.position_y = event.y;
             payload.effect_scale = event.scale;
@@ -115,7 +115,13 @@ void ServerNetworkSystem::init(Registry& registry)
                 case 3: powerupType = protocol::PowerupType::WEAPON_UPGRADE; break;
                 default: powerupType = protocol::PowerupType::WEAPON_UPGRADE; break;
             }
-            queue_powerup_collected(static_cast<uint32_t>(event.player), powerupType);
+            queue_powerup_collected(ecs::entity::to_network_id(event.player), powerupType);
+        });
+
+    // Inputs published by the network thread, drained by the session each tick
+    clientInputSubId_ = registry.get_event_bus().subscribe<ClientInputEvent>(
+        [this](const ClientInputEvent& event) {
+            queue_input(event.player_id, event.input);
         });
 }
 
@@ -173,7 +179,7 @@ void ServerNetworkSystem::queue_entity_spawn(Entity entity, protocol::EntityType
                                               float x, float y, uint16_t health, uint8_t subtype)
 {
     protocol::ServerEntitySpawnPayload spawn;
-    spawn.entity_id = ByteOrder::host_to_net32(entity);
+    spawn.entity_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(entity));
     spawn.entity_type = type;
     spawn.spawn_x = x;
     spawn.spawn_y = y;
@@ -187,7 +193,7 @@ void ServerNetworkSystem::queue_entity_spawn(Entity entity, protocol::EntityType
 void ServerNetworkSystem::queue_entity_destroy(Entity entity)
 {
     std::lock_guard lock(destroys_mutex_);
-    pending_destroys_.push(entity);
+    pending_destroys_.push(ecs::entity::to_network_id(entity));
 }
 
 void ServerNetworkSystem::queue_powerup_collected(uint32_t player_id, protocol::PowerupType type)
@@ -217,7 +223,7 @@ void ServerNetworkSystem::queue_player_level_up(uint32_t player_id, Entity entit
 {
     protocol::ServerPlayerLevelUpPayload payload;
     payload.player_id = ByteOrder::host_to_net32(player_id);
-    payload.entity_id = ByteOrder::host_to_net32(static_cast<uint32_t>(entity));
+    payload.entity_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(entity));
     payload.new_level = new_level;
     payload.new_ship_type = new_ship_type;
     payload.new_weapon_type = new_weapon_type;
@@ -319,33 +325,22 @@ std::vector<uint8_t> ServerNetworkSystem::serialize_snapshot(Registry& registry)
     auto& positions = registry.get_components<Position>();
     auto& velocities = registry.get_components<Velocity>();
     auto& healths = registry.get_components<Health>();
-    auto& to_destroy = registry.get_components<ToDestroy>();
     auto& enemies = registry.get_components<Enemy>();
     auto& ais = registry.get_components<AI>();
     auto& projectiles = registry.get_components<Projectile>();
     auto& walls = registry.get_components<Wall>();
     auto& controllables = registry.get_components<Controllable>();
 
-    // Collect entities by priority: players first, then projectiles, then enemies
+    // Collect entities by priority: players first, then projectiles, then enemies.
+    // Observers are maintained by the registry on add/remove (built on first call),
+    // so the snapshot no longer scans every Position
     // Walls are excluded from snapshots - they are spawned once and scroll predictably
-    std::vector<Entity> priority_entities;
-    std::vector<Entity> projectile_entities;
-    std::vector<Entity> enemy_entities;
-
-    for (size_t i = 0; i < positions.size(); ++i) {
-        Entity entity = positions.get_entity_at(i);
-        if (to_destroy.has_entity(entity))
-            continue;
-
-        if (controllables.has_entity(entity)) {
-            priority_entities.push_back(entity);  // Players - highest priority
-        } else if (projectiles.has_entity(entity)) {
-            projectile_entities.push_back(entity);  // Projectiles - high priority
-        } else if (enemies.has_entity(entity)) {
-            enemy_entities.push_back(entity);  // Enemies - medium priority
-        }
-        // Walls are NOT included in snapshots - they scroll predictably
-    }
+    const ecs::Observer& priority_entities =
+        registry.observer<Position, Controllable>(ecs::exclude<ToDestroy>);
+    const ecs::Observer& projectile_entities =
+        registry.observer<Position, Projectile>(ecs::exclude<ToDestroy, Controllable>);
+    const ecs::Observer& enemy_entities =
+        registry.observer<Position, Enemy>(ecs::exclude<ToDestroy, Controllable, Projectile>);
 
     std::vector<protocol::EntityState> entity_states;
     entity_states.reserve(MAX_ENTITIES_PER_SNAPSHOT);
@@ -358,7 +353,7 @@ std::vector<uint8_t> ServerNetworkSystem::serialize_snapshot(Registry& registry)
 
         Position& pos = positions[entity];
         protocol::EntityState state;
-        state.entity_id = ByteOrder::host_to_net32(entity);
+        state.entity_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(entity));
 
         // Determine entity type
         if (controllables.has_entity(entity)) {
@@ -393,10 +388,9 @@ std::vector<uint8_t> ServerNetworkSystem::serialize_snapshot(Registry& registry)
 
         state.position_x = pos.x;
         state.position_y = pos.y;
-        if (velocities.has_entity(entity)) {
-            Velocity& vel = velocities[entity];
-            state.velocity_x = static_cast<int16_t>(vel.x * 10.0f);
-            state.velocity_y = static_cast<int16_t>(vel.y * 10.0f);
+        if (Velocity* vel = velocities.find(entity)) {
+            state.velocity_x = static_cast<int16_t>(vel->x * 10.0f);
+            state.velocity_y = static_cast<int16_t>(vel->y * 10.0f);
         } else {
             state.velocity_x = 0;
             state.velocity_y = 0;
@@ -435,11 +429,11 @@ std::vector<uint8_t> ServerNetworkSystem::serialize_snapshot(Registry& registry)
     };
 
     // Add entities in priority order
-    for (Entity e : priority_entities)
+    for (Entity e : priority_entities.entities())
         add_entity_state(e);
-    for (Entity e : projectile_entities)
+    for (Entity e : projectile_entities.entities())
         add_entity_state(e);
-    for (Entity e : enemy_entities)
+    for (Entity e : enemy_entities.entities())
         add_entity_state(e);
 
     uint16_t entity_count = static_cast<uint16_t>(entity_states.size());
@@ -623,8 +617,8 @@ void ServerNetworkSystem::spawn_projectile(Registry& registry, Entity owner, flo
     registry.add_component(projectile, ProjectileOwner{owner});  // Track who fired this projectile
     registry.add_component(projectile, NoFriction{});
     protocol::ServerProjectileSpawnPayload spawn;
-    spawn.projectile_id = ByteOrder::host_to_net32(projectile);
-    spawn.owner_id = ByteOrder::host_to_net32(owner);
+    spawn.projectile_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(projectile));
+    spawn.owner_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(owner));
     spawn.projectile_type = protocol::ProjectileType::BULLET;
     spawn.spawn_x = x;
     spawn.spawn_y = y;
@@ -649,8 +643,8 @@ void ServerNetworkSystem::spawn_enemy_projectile(Registry& registry, Entity owne
     registry.add_component(projectile, ProjectileOwner{owner});  // Track which enemy fired this
     registry.add_component(projectile, NoFriction{});
     protocol::ServerProjectileSpawnPayload spawn;
-    spawn.projectile_id = ByteOrder::host_to_net32(projectile);
-    spawn.owner_id = ByteOrder::host_to_net32(owner);
+    spawn.projectile_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(projectile));
+    spawn.owner_id = ByteOrder::host_to_net32(ecs::entity::to_network_id(owner));
     spawn.projectile_type = protocol::ProjectileType::BULLET;
     spawn.spawn_x = x;
     spawn.spawn_y = y;
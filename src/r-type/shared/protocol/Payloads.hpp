@@ -342,7 +342,7 @@ static_assert(sizeof(ClientInputPayload) == 14, "ClientInputPayload must be 14 b
  */
 PACK_START
 struct PACKED EntityState {
-    uint32_t entity_id;
+    uint32_t entity_id;          // Server handle packed by ecs::entity::to_network_id (index + generation)
     EntityType entity_type;
     float position_x;
     float position_y;
@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_eventbus
+*/
+
+// EventBus dispatch cost: immediate publish and deferred publish followed
+// by process_deferred, for N events per tick and 1 or 4 subscribers.
+
+#include <benchmark/benchmark.h>
+#include "core/event/EventBus.hpp"
+#include "core/event/Event.hpp"
+#include <cstdint>
+
+namespace {
+
+struct HitEvent : public core::Event {
+    uint32_t target;
+    int damage;
+
+    HitEvent(uint32_t t, int d) : target(t), damage(d) {}
+};
+
+void subscribe(core::EventBus& bus, int64_t subscribers, int64_t& sink)
+{
+    for (int64_t i = 0; i < subscribers; i++)
+        bus.subscribe<HitEvent>([&sink](const HitEvent& event) { sink += event.damage; });
+}
+
+// args : {événements par tick, abonnés}
+void BM_EventBus_Publish(benchmark::State& state)
+{
+    const int64_t count = state.range(0);
+    core::EventBus bus;
+    int64_t sink = 0;
+
+    subscribe(bus, state.range(1), sink);
+    for (auto _ : state) {
+        for (int64_t i = 0; i < count; i++)
+            bus.publish(HitEvent{static_cast<uint32_t>(i), 1});
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EventBus_Publish)->ArgsProduct({{1000, 10000, 100000}, {1, 4}});
+
+void BM_EventBus_PublishDeferred(benchmark::State& state)
+{
+    const int64_t count = state.range(0);
+    core::EventBus bus;
+    int64_t sink = 0;
+
+    subscribe(bus, state.range(1), sink);
+    for (auto _ : state) {
+        for (int64_t i = 0; i < count; i++)
+            bus.publish_deferred(HitEvent{static_cast<uint32_t>(i), 1});
+        bus.process_deferred();
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_EventBus_PublishDeferred)->ArgsProduct({{1000, 10000, 100000}, {1, 4}});
+
+}
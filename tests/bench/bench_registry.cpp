@@ -0,0 +1,154 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_registry
+*/
+
+// Registry micro benchmarks: entity churn, structural changes and
+// iteration over one, two and three components (view and owning group).
+
+#include <benchmark/benchmark.h>
+#include "ecs/Registry.hpp"
+#include "ecs/CoreComponents.hpp"
+#include <vector>
+
+namespace {
+
+void register_core(Registry& registry)
+{
+    registry.register_component<Position>();
+    registry.register_component<Velocity>();
+    registry.register_component<Collider>();
+}
+
+// Monde de base : tout le monde a une Position, 3 sur 4 une Velocity, 1 sur 2 un Collider
+void populate(Registry& registry, size_t count)
+{
+    register_core(registry);
+    for (size_t i = 0; i < count; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component(e, Position{static_cast<float>(i), 0.0f});
+        if (i % 4 != 0)
+            registry.add_component(e, Velocity{1.0f, 1.0f});
+        if (i % 2 == 0)
+            registry.add_component(e, Collider{16.0f, 16.0f});
+    }
+}
+
+// Spawn then kill N entities with two components (free list recycling)
+void BM_Registry_SpawnKillChurn(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Registry registry;
+    std::vector<Entity> entities;
+
+    register_core(registry);
+    entities.reserve(count);
+    for (auto _ : state) {
+        for (size_t i = 0; i < count; i++) {
+            Entity e = registry.spawn_entity();
+            registry.add_component(e, Position{1.0f, 2.0f});
+            registry.add_component(e, Velocity{3.0f, 4.0f});
+            entities.push_back(e);
+        }
+        for (Entity e : entities)
+            registry.kill_entity(e);
+        entities.clear();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_Registry_SpawnKillChurn)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Add then remove a component on N live entities
+void BM_Registry_AddRemoveComponent(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Registry registry;
+    std::vector<Entity> entities;
+
+    register_core(registry);
+    for (size_t i = 0; i < count; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component(e, Position{});
+        entities.push_back(e);
+    }
+    for (auto _ : state) {
+        for (Entity e : entities)
+            registry.add_component(e, Collider{8.0f, 8.0f});
+        for (Entity e : entities)
+            registry.remove_component<Collider>(e);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_Registry_AddRemoveComponent)->RangeMultiplier(10)->Range(1000, 100000);
+
+void BM_Registry_IterateOne(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Registry registry;
+
+    populate(registry, count);
+    for (auto _ : state) {
+        registry.view<Position>().each([](Position& pos) {
+            pos.x += 1.0f;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_Registry_IterateOne)->RangeMultiplier(10)->Range(1000, 100000);
+
+void BM_Registry_IterateTwo(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Registry registry;
+
+    populate(registry, count);
+    for (auto _ : state) {
+        registry.view<Position, Velocity>().each([](Position& pos, Velocity& vel) {
+            pos.x += vel.x;
+            pos.y += vel.y;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_Registry_IterateTwo)->RangeMultiplier(10)->Range(1000, 100000);
+
+void BM_Registry_IterateThree(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Registry registry;
+
+    populate(registry, count);
+    for (auto _ : state) {
+        registry.view<Position, Velocity, Collider>().each([](Position& pos, Velocity& vel, Collider& col) {
+            pos.x += vel.x * col.width;
+            pos.y += vel.y * col.height;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_Registry_IterateThree)->RangeMultiplier(10)->Range(1000, 100000);
+
+void BM_Registry_IterateTwoGroup(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Registry registry;
+
+    populate(registry, count);
+    registry.group<Position, Velocity>();
+    for (auto _ : state) {
+        registry.group<Position, Velocity>().each([](Position& pos, Velocity& vel) {
+            pos.x += vel.x;
+            pos.y += vel.y;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_Registry_IterateTwoGroup)->RangeMultiplier(10)->Range(1000, 100000);
+
+}
@@ -0,0 +1,154 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_systems
+*/
+
+// Macro benchmarks: one full tick of PhysiqueSystem, CollisionSystem and
+// DestroySystem on a populated world of N entities.
+
+#include <benchmark/benchmark.h>
+#include "ecs/Registry.hpp"
+#include "ecs/CoreComponents.hpp"
+#include "ecs/systems/PhysiqueSystem.hpp"
+#include "ecs/systems/DestroySystem.hpp"
+#include "components/GameComponents.hpp"
+#include "systems/CollisionSystem.hpp"
+#include <vector>
+
+namespace {
+
+constexpr float DT = 1.0f / 60.0f;
+constexpr size_t PLAYERS = 4;
+
+// Velocity de départ : la friction la ferait tendre vers des flottants dénormalisés
+Velocity seed_velocity(size_t i)
+{
+    return Velocity{static_cast<float>(i % 200) - 100.0f, static_cast<float>(i % 120) - 60.0f};
+}
+
+void BM_System_PhysiqueTick(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    Registry registry;
+    PhysiqueSystem physique;
+
+    registry.register_component<Position>();
+    registry.register_component<Velocity>();
+    registry.register_component<Controllable>();
+    registry.register_component<NoFriction>();
+    for (size_t i = 0; i < count; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component(e, Position{static_cast<float>(i % 1920), static_cast<float>(i % 1080)});
+        registry.add_component(e, seed_velocity(i));
+        // Un quart de projectiles sans friction, quelques joueurs bornés à l'écran
+        if (i % 4 == 0)
+            registry.add_component(e, NoFriction{});
+        if (i < PLAYERS)
+            registry.add_component(e, Controllable{});
+    }
+    int64_t ticks = 0;
+    for (auto _ : state) {
+        physique.update(registry, DT);
+        if (++ticks % 1024 == 0) {
+            state.PauseTiming();
+            registry.view<Velocity>().each([](Entity e, Velocity& vel) {
+                vel = seed_velocity(static_cast<size_t>(e));
+            });
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_System_PhysiqueTick)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Monde sans contact : mesure le coût de détection, pas celui des réactions
+void BM_System_CollisionTick(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    const size_t projectiles = count / 100;
+    Registry registry;
+    CollisionSystem collision;
+
+    registry.register_component<Position>();
+    registry.register_component<Collider>();
+    registry.register_component<Controllable>();
+    registry.register_component<Enemy>();
+    registry.register_component<Projectile>();
+    registry.register_component<Wall>();
+    registry.register_component<Invulnerability>();
+    registry.register_component<Damage>();
+    registry.register_component<ToDestroy>();
+    registry.register_component<Shield>();
+    registry.register_component<Kamikaze>();
+    registry.register_component<Sprite>();
+    for (size_t i = 0; i < PLAYERS; i++) {
+        Entity player = registry.spawn_entity();
+        registry.add_component(player, Position{1000.0f + static_cast<float>(i) * 40.0f, -500.0f});
+        registry.add_component(player, Collider{32.0f, 16.0f});
+        registry.add_component(player, Controllable{});
+    }
+    for (size_t i = 0; i < 32; i++) {
+        Entity wall = registry.spawn_entity();
+        registry.add_component(wall, Position{static_cast<float>(i) * 64.0f, -5000.0f});
+        registry.add_component(wall, Collider{64.0f, 64.0f});
+        registry.add_component(wall, Wall{});
+    }
+    for (size_t i = 0; i < projectiles; i++) {
+        Entity bullet = registry.spawn_entity();
+        registry.add_component(bullet, Position{static_cast<float>(i % 40) * 20.0f, static_cast<float>(i / 40) * 20.0f});
+        registry.add_component(bullet, Collider{8.0f, 4.0f});
+        registry.add_component(bullet, Projectile{});
+        registry.add_component(bullet, Damage{});
+    }
+    for (size_t i = projectiles + PLAYERS + 32; i < count; i++) {
+        Entity enemy = registry.spawn_entity();
+        registry.add_component(enemy, Position{2000.0f + static_cast<float>(i % 1000) * 20.0f,
+            static_cast<float>(i / 1000) * 20.0f});
+        registry.add_component(enemy, Collider{16.0f, 16.0f});
+        registry.add_component(enemy, Enemy{});
+    }
+    for (auto _ : state)
+        collision.update(registry, DT);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_System_CollisionTick)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMicrosecond);
+
+// Un dixième du monde marqué ToDestroy à chaque tick, recréé hors chrono
+void BM_System_DestroyTick(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    const size_t doomed = count / 10;
+    Registry registry;
+    DestroySystem destroy;
+    std::vector<Entity> entities;
+
+    registry.register_component<Position>();
+    registry.register_component<Velocity>();
+    registry.register_component<ToDestroy>();
+    for (size_t i = 0; i < count; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component(e, Position{});
+        registry.add_component(e, Velocity{});
+        entities.push_back(e);
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        // Les entités tuées au tick précédent sont recréées (slots recyclés)
+        for (size_t i = 0; i < doomed; i++) {
+            if (!registry.is_alive(entities[i])) {
+                entities[i] = registry.spawn_entity();
+                registry.add_component(entities[i], Position{});
+                registry.add_component(entities[i], Velocity{});
+            }
+            registry.add_component(entities[i], ToDestroy{});
+        }
+        state.ResumeTiming();
+        destroy.update(registry, DT);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * doomed));
+}
+BENCHMARK(BM_System_DestroyTick)->RangeMultiplier(10)->Range(1000, 100000);
+
+}
@@ -0,0 +1,119 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_eventbus_contention
+*/
+
+// Producers hand events to one consumer thread, the way the network thread
+// and the session workers feed a session. Compares EventBus::publish_concurrent
+// (lock-free MPSC queue) with a mutex-guarded std::queue, the pattern used by
+// ServerNetworkSystem, for 1 to 8 producers.
+
+#include "core/event/EventBus.hpp"
+#include "core/event/Event.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct InputEvent : public core::Event {
+    uint32_t player_id;
+    uint32_t sequence;
+
+    InputEvent(uint32_t id, uint32_t seq) : player_id(id), sequence(seq) {}
+};
+
+constexpr size_t EVENTS_PER_PRODUCER = 200000;
+
+// Temps total pour que le consommateur reçoive tous les événements
+template <typename Publish, typename Drain>
+double run(size_t producers, Publish publish, Drain drain)
+{
+    const size_t total = producers * EVENTS_PER_PRODUCER;
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    size_t received = 0;
+
+    for (size_t p = 0; p < producers; p++) {
+        threads.emplace_back([&, p]() {
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            for (size_t i = 0; i < EVENTS_PER_PRODUCER; i++)
+                publish(InputEvent(static_cast<uint32_t>(p), static_cast<uint32_t>(i)));
+        });
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    go.store(true, std::memory_order_release);
+    while (received < total)
+        received += drain();
+    auto end = std::chrono::high_resolution_clock::now();
+    for (auto& thread : threads)
+        thread.join();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+double bench_event_bus(size_t producers)
+{
+    core::EventBus bus;
+    size_t delivered = 0;
+
+    bus.subscribe<InputEvent>([&delivered](const InputEvent&) {
+        delivered++;
+    });
+    return run(producers,
+        [&bus](const InputEvent& event) { bus.publish_concurrent(event); },
+        [&bus, &delivered]() {
+            delivered = 0;
+            bus.process_deferred();
+            return delivered;
+        });
+}
+
+double bench_mutex_queue(size_t producers)
+{
+    std::mutex mutex;
+    std::queue<InputEvent> queue;
+    std::function<void(const InputEvent&)> callback = [](const InputEvent&) {};
+
+    return run(producers,
+        [&](const InputEvent& event) {
+            std::lock_guard lock(mutex);
+            queue.push(event);
+        },
+        [&]() {
+            std::queue<InputEvent> batch;
+            {
+                std::lock_guard lock(mutex);
+                std::swap(batch, queue);
+            }
+            size_t count = batch.size();
+            for (; !batch.empty(); batch.pop())
+                callback(batch.front());
+            return count;
+        });
+}
+
+}
+
+int main()
+{
+    std::cout << "EventBus cross-thread hand-over, " << EVENTS_PER_PRODUCER << " events per producer\n";
+    for (size_t producers : {1, 2, 4, 8}) {
+        double lockFree = bench_event_bus(producers);
+        double locked = bench_mutex_queue(producers);
+        double events = static_cast<double>(producers * EVENTS_PER_PRODUCER);
+
+        std::cout << "  " << producers << " producer(s): publish_concurrent "
+                  << events / lockFree / 1000.0 << " Mev/s, mutex+queue "
+                  << events / locked / 1000.0 << " Mev/s\n";
+    }
+    return 0;
+}
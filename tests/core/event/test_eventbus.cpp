@@ -2,6 +2,8 @@
 #include "core/event/Event.hpp"
 #include <gtest/gtest.h>
 #include <string>
+#include <thread>
+#include <vector>
 
 struct TestEvent : public core::Event {
     int value;
@@ -352,3 +354,135 @@ TEST(EventBusTest, GameLikeScenario) {
     EXPECT_EQ(soundsPlayed[0], "explosion.wav");
     EXPECT_EQ(soundsPlayed[1], "coin.wav");
 }
+
+TEST(EventBusTest, UnsubscribeInsideCallbackIsSafe) {
+    core::EventBus bus;
+    int firstCalls = 0;
+    int secondCalls = 0;
+    core::EventBus::SubscriptionId firstId = 0;
+
+    firstId = bus.subscribe<TestEvent>([&](const TestEvent&) {
+        firstCalls++;
+        bus.unsubscribe(firstId);
+    });
+    bus.subscribe<TestEvent>([&](const TestEvent&) {
+        secondCalls++;
+    });
+    bus.publish(TestEvent{1});
+    bus.publish(TestEvent{2});
+    EXPECT_EQ(firstCalls, 1);
+    EXPECT_EQ(secondCalls, 2);
+    EXPECT_EQ(bus.getSubscriberCount<TestEvent>(), 1);
+}
+
+TEST(EventBusTest, SubscribeInsideCallbackStartsWithNextPublish) {
+    core::EventBus bus;
+    int lateCalls = 0;
+    bool subscribed = false;
+
+    bus.subscribe<TestEvent>([&](const TestEvent&) {
+        if (subscribed)
+            return;
+        subscribed = true;
+        bus.subscribe<TestEvent>([&](const TestEvent&) {
+            lateCalls++;
+        });
+    });
+    bus.publish(TestEvent{1});
+    EXPECT_EQ(lateCalls, 0);
+    bus.publish(TestEvent{2});
+    EXPECT_EQ(lateCalls, 1);
+}
+
+TEST(EventBusTest, DeferredEventsKeepOrderAcrossRingWrap) {
+    core::EventBus bus;
+    std::vector<int> received;
+
+    bus.subscribe<TestEvent>([&](const TestEvent& evt) {
+        received.push_back(evt.value);
+    });
+    for (int round = 0; round < 3; round++) {
+        received.clear();
+        for (int i = 0; i < 40; i++)
+            bus.publish_deferred(TestEvent{i});
+        bus.process_deferred();
+        ASSERT_EQ(received.size(), 40);
+        for (int i = 0; i < 40; i++)
+            EXPECT_EQ(received[i], i);
+    }
+}
+
+TEST(EventBusTest, EventsDeferredDuringProcessingAreDelivered) {
+    core::EventBus bus;
+    std::vector<std::string> messages;
+
+    bus.subscribe<TestEvent>([&](const TestEvent& evt) {
+        bus.publish_deferred(AnotherTestEvent{"from " + std::to_string(evt.value)});
+        if (evt.value == 1)
+            bus.publish_deferred(TestEvent{2});
+    });
+    bus.subscribe<AnotherTestEvent>([&](const AnotherTestEvent& evt) {
+        messages.push_back(evt.message);
+    });
+    bus.publish_deferred(TestEvent{1});
+    bus.process_deferred();
+    EXPECT_EQ(bus.getDeferredEventCount(), 0);
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_EQ(messages[0], "from 1");
+    EXPECT_EQ(messages[1], "from 2");
+}
+
+TEST(EventBusTest, ConcurrentPublishersKeepPerThreadOrder) {
+    constexpr int PRODUCERS = 4;
+    constexpr int EVENTS_PER_PRODUCER = 5000;
+    core::EventBus bus;
+    std::vector<int> lastSeen(PRODUCERS, -1);
+    int received = 0;
+    bool ordered = true;
+
+    bus.subscribe<TestEvent>([&](const TestEvent& evt) {
+        int producer = evt.value / EVENTS_PER_PRODUCER;
+        int sequence = evt.value % EVENTS_PER_PRODUCER;
+        if (sequence != lastSeen[producer] + 1)
+            ordered = false;
+        lastSeen[producer] = sequence;
+        received++;
+    });
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&bus, p]() {
+            for (int i = 0; i < EVENTS_PER_PRODUCER; i++)
+                bus.publish_concurrent(TestEvent{p * EVENTS_PER_PRODUCER + i});
+        });
+    }
+    // Le thread propriétaire draine pendant que les producteurs publient
+    while (received < PRODUCERS * EVENTS_PER_PRODUCER) {
+        bus.process_deferred();
+        std::this_thread::yield();
+    }
+    for (auto& producer : producers)
+        producer.join();
+    bus.process_deferred();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(received, PRODUCERS * EVENTS_PER_PRODUCER);
+    EXPECT_EQ(bus.getDeferredEventCount(), 0);
+}
+
+TEST(EventBusTest, ConcurrentEventsAreCountedAndCleared) {
+    core::EventBus bus;
+    int calls = 0;
+
+    bus.subscribe<TestEvent>([&](const TestEvent&) {
+        calls++;
+    });
+    bus.publish_concurrent(TestEvent{1});
+    bus.publish_concurrent(TestEvent{2});
+    EXPECT_EQ(bus.getDeferredEventCount(), 2);
+    EXPECT_EQ(calls, 0);
+    bus.clear();
+    EXPECT_EQ(bus.getDeferredEventCount(), 0);
+    bus.process_deferred();
+    EXPECT_EQ(calls, 0);
+}
@@ -0,0 +1,75 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** test_tick_scheduler
+*/
+
+#include <gtest/gtest.h>
+#include "core/TickScheduler.hpp"
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// STEP AND DEADLINES
+// ============================================================================
+
+TEST(TickSchedulerTest, StepIsExactToTheNanosecond) {
+    core::TickScheduler scheduler(64);
+
+    // 1000 / 64 tronqué donnait 15 ms, soit ~66 ticks par seconde
+    EXPECT_EQ(std::chrono::duration_cast<std::chrono::nanoseconds>(scheduler.step()).count(), 15625000);
+    EXPECT_FLOAT_EQ(scheduler.step_seconds(), 0.015625f);
+}
+
+TEST(TickSchedulerTest, DeadlinesDoNotDrift) {
+    core::TickScheduler scheduler(200);
+    auto start = core::TickScheduler::Clock::now();
+
+    // Le premier appel ancre la grille, les 20 suivants tombent sur start + k * 5 ms
+    scheduler.wait();
+    for (int i = 0; i < 20; i++)
+        scheduler.wait();
+    auto elapsed = core::TickScheduler::Clock::now() - start;
+
+    EXPECT_GE(elapsed, 100ms);
+    EXPECT_EQ(scheduler.stats().ticks, 21u);
+}
+
+// ============================================================================
+// LATE TICKS
+// ============================================================================
+
+TEST(TickSchedulerTest, CatchUpRunsMissedStepsAndCountsOverrun) {
+    core::TickScheduler scheduler(100, core::CatchUpPolicy::CatchUp, 8);
+
+    EXPECT_EQ(scheduler.wait(), 1u);
+    // Travail de 3,5 pas : les échéances +10, +20 et +30 ms sont passées
+    std::this_thread::sleep_for(35ms);
+    uint32_t steps = scheduler.wait();
+    core::TickStats stats = scheduler.stats();
+
+    EXPECT_GE(steps, 3u);
+    EXPECT_EQ(stats.overruns, 1u);
+    EXPECT_EQ(stats.late_starts, 1u);
+    EXPECT_EQ(stats.dropped, 0u);
+    EXPECT_EQ(stats.ticks, 1u + steps);
+}
+
+TEST(TickSchedulerTest, DropPolicyRunsOneStepAndCountsTheRest) {
+    core::TickScheduler scheduler(100, core::CatchUpPolicy::Drop);
+
+    scheduler.wait();
+    std::this_thread::sleep_for(35ms);
+    EXPECT_EQ(scheduler.wait(), 1u);
+    core::TickStats stats = scheduler.stats();
+
+    EXPECT_GE(stats.dropped, 2u);
+    EXPECT_EQ(stats.ticks, 2u);
+
+    scheduler.reset();
+    EXPECT_EQ(scheduler.stats().dropped, 0u);
+    EXPECT_EQ(scheduler.stats().ticks, 0u);
+}
@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_archetype_backend
+*/
+
+// SparseSet vs Archetype storage backend on a mixed world (players, enemies,
+// bullets, decor) at 1k/10k/100k entities, after the whole population has
+// been replaced once by spawn/kill churn:
+//  - query: view<Position, Velocity, Collider>(exclude<NoFriction>), the shape
+//    of the collision and bullet queries, ns per entity in the world;
+//  - churn: one tick of 2% spawns + 2% kills followed by the same query, the
+//    archetype side paying for its table updates and the lazy pool sort.
+
+#include "ecs/Registry.hpp"
+#include "ecs/CoreComponents.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+void spawn(Registry& registry, size_t i, std::vector<Entity>& alive)
+{
+    Entity e = registry.spawn_entity();
+
+    registry.add_component(e, Position{static_cast<float>(i % 1920), static_cast<float>(i % 1080)});
+    // Un quart de décor immobile, le reste se déplace et entre en collision
+    if (i % 4 != 0) {
+        registry.add_component(e, Velocity{-300.0f, 10.0f});
+        registry.add_component(e, Collider{8.0f, 8.0f});
+    }
+    if (i % 4 == 1)
+        registry.add_component(e, NoFriction{});
+    if (i % 64 == 0)
+        registry.add_component(e, Controllable{});
+    alive.push_back(e);
+}
+
+void populate(Registry& registry, size_t count, std::vector<Entity>& alive)
+{
+    registry.register_component<Position>();
+    registry.register_component<Velocity>();
+    registry.register_component<Collider>();
+    registry.register_component<Controllable>();
+    registry.register_component<NoFriction>();
+    for (size_t i = 0; i < count; i++)
+        spawn(registry, i, alive);
+}
+
+float query(Registry& registry)
+{
+    float sum = 0.0f;
+
+    registry.view<Position, Velocity, Collider>(ecs::exclude<NoFriction>)
+        .each([&sum](Position& pos, Velocity& vel, Collider& col) {
+            pos.x += vel.x * 0.016f;
+            sum += pos.x + col.width;
+        });
+    return sum;
+}
+
+void churn(Registry& registry, std::vector<Entity>& alive, size_t& next)
+{
+    size_t step = alive.size() / 50 + 1;
+
+    for (size_t i = 0; i < step; i++) {
+        size_t pick = (next * 7919 + i * 104729) % alive.size();
+        registry.kill_entity(alive[pick]);
+        alive[pick] = alive.back();
+        alive.pop_back();
+        spawn(registry, next++, alive);
+    }
+}
+
+template <typename Func>
+double ns_per_entity(size_t count, int iterations, Func&& func)
+{
+    func();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+        func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations / count;
+}
+
+}
+
+int main()
+{
+    volatile float sink = 0.0f;
+
+    std::cout << "view<Position, Velocity, Collider>(exclude<NoFriction>), ns per entity\n";
+    for (size_t count : {1000, 10000, 100000}) {
+        int iterations = static_cast<int>(5000000 / count);
+        double cost[2][2];
+
+        for (int backend = 0; backend < 2; backend++) {
+            Registry registry;
+            std::vector<Entity> alive;
+            size_t next = count;
+
+            if (backend == 1)
+                registry.set_storage_backend(ecs::StorageBackend::Archetype);
+            populate(registry, count, alive);
+            // Un cycle de vie complet : les pools ne sont plus dans l'ordre d'insertion
+            for (int round = 0; round < 50; round++)
+                churn(registry, alive, next);
+            cost[backend][0] = ns_per_entity(count, iterations, [&] { sink = sink + query(registry); });
+            cost[backend][1] = ns_per_entity(count, iterations, [&] {
+                churn(registry, alive, next);
+                sink = sink + query(registry);
+            });
+        }
+        std::cout << "  " << count << " entities: query sparse " << cost[0][0]
+                  << ", archetype " << cost[1][0]
+                  << " | churn+query sparse " << cost[0][1]
+                  << ", archetype " << cost[1][1] << "\n";
+    }
+    return 0;
+}
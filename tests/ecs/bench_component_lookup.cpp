@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_component_lookup
+*/
+
+// Per-call cost of Registry::get_components<T>() (component family id +
+// array index) against the previous storage, an
+// std::unordered_map<std::type_index, std::any> followed by std::any_cast.
+
+#include "ecs/Registry.hpp"
+#include <any>
+#include <chrono>
+#include <iostream>
+#include <typeindex>
+#include <unordered_map>
+
+namespace {
+
+template <int N>
+struct Comp {
+    float value;
+};
+
+// Previous Registry component storage, kept here only as the comparison baseline
+class TypeIndexStorage {
+    public:
+        template <typename Component>
+        void register_component()
+        {
+            components[std::type_index(typeid(Component))] = SparseSet<Component>();
+        }
+
+        template <typename Component>
+        SparseSet<Component>& get_components()
+        {
+            return std::any_cast<SparseSet<Component>&>(components[std::type_index(typeid(Component))]);
+        }
+
+    private:
+        std::unordered_map<std::type_index, std::any> components;
+};
+
+template <typename Storage, int... Ns>
+void register_all(Storage& storage, std::integer_sequence<int, Ns...>)
+{
+    (storage.template register_component<Comp<Ns>>(), ...);
+}
+
+template <typename Storage, int... Ns>
+size_t lookup_all(Storage& storage, std::integer_sequence<int, Ns...>)
+{
+    return (storage.template get_components<Comp<Ns>>().size() + ...);
+}
+
+template <typename Storage>
+void run(const char* name, int iterations)
+{
+    // ~40 component types, the order of magnitude registered by a GameSession
+    using Types = std::make_integer_sequence<int, 40>;
+    Storage storage;
+    register_all(storage, Types{});
+
+    size_t checksum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+        checksum += lookup_all(storage, Types{});
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "  " << name << " | " << ns / (static_cast<double>(iterations) * 40)
+              << " ns/call (checksum " << checksum << ")\n";
+}
+
+}
+
+int main()
+{
+    constexpr int iterations = 200000;
+
+    std::cout << "Component pool lookup cost (" << iterations << " x 40 types)\n";
+    run<TypeIndexStorage>("type_index + any_cast", iterations);
+    run<Registry>("family id + array   ", iterations);
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_registry_arena
+*/
+
+// Lifetime of a game session Registry, pools on the global heap vs in a
+// per-session std::pmr::unsynchronized_pool_resource (what GameSession does):
+// create and populate 2k entities, run 600 ticks of 5% spawn/kill churn,
+// destroy, each phase timed separately.
+// Several sessions are interleaved, as on a loaded server, so that their
+// allocations compete for the same heap. Reports ms per session.
+
+#include "ecs/Registry.hpp"
+#include "ecs/CoreComponents.hpp"
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace {
+
+struct Session {
+    std::unique_ptr<std::pmr::unsynchronized_pool_resource> arena;
+    std::unique_ptr<Registry> registry;
+    std::vector<Entity> alive;
+    size_t next = 0;
+};
+
+void spawn(Session& session)
+{
+    Registry& registry = *session.registry;
+    Entity e = registry.spawn_entity();
+    size_t i = session.next++;
+
+    registry.add_component(e, Position{static_cast<float>(i % 1920), static_cast<float>(i % 1080)});
+    registry.add_component(e, Velocity{-300.0f, 10.0f});
+    registry.add_component(e, Collider{8.0f, 8.0f});
+    registry.add_component(e, Input{});
+    if (i % 4 == 1)
+        registry.add_component(e, NoFriction{});
+    session.alive.push_back(e);
+}
+
+void open(Session& session, bool arena)
+{
+    if (arena) {
+        session.arena = std::make_unique<std::pmr::unsynchronized_pool_resource>();
+        session.registry = std::make_unique<Registry>(session.arena.get());
+    } else {
+        session.registry = std::make_unique<Registry>();
+    }
+    session.registry->register_component<Position>();
+    session.registry->register_component<Velocity>();
+    session.registry->register_component<Collider>();
+    session.registry->register_component<Input>();
+    session.registry->register_component<NoFriction>();
+    for (int i = 0; i < 2000; i++)
+        spawn(session);
+}
+
+void tick(Session& session)
+{
+    size_t step = session.alive.size() / 20 + 1;
+
+    for (size_t i = 0; i < step; i++) {
+        size_t pick = (session.next * 7919 + i * 104729) % session.alive.size();
+        session.registry->kill_entity(session.alive[pick]);
+        session.alive[pick] = session.alive.back();
+        session.alive.pop_back();
+        spawn(session);
+    }
+}
+
+void close(Session& session)
+{
+    // Le Registry avant son arène
+    session.registry.reset();
+    session.arena.reset();
+    session.alive.clear();
+    session.next = 0;
+}
+
+struct Cost {
+    double open = 0.0;
+    double churn = 0.0;
+    double close = 0.0;
+};
+
+Cost ms_per_session(bool arena, int sessions, int rounds)
+{
+    using clock = std::chrono::high_resolution_clock;
+    std::vector<Session> pool(sessions);
+    Cost cost;
+
+    auto elapsed = [](clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    };
+    for (int round = 0; round < rounds; round++) {
+        auto start = clock::now();
+        for (Session& session : pool)
+            open(session, arena);
+        cost.open += elapsed(start);
+        start = clock::now();
+        for (int t = 0; t < 600; t++)
+            for (Session& session : pool)
+                tick(session);
+        cost.churn += elapsed(start);
+        start = clock::now();
+        for (Session& session : pool)
+            close(session);
+        cost.close += elapsed(start);
+    }
+    cost.open /= sessions * rounds;
+    cost.churn /= sessions * rounds;
+    cost.close /= sessions * rounds;
+    return cost;
+}
+
+}
+
+int main()
+{
+    std::cout << "Registry lifetime (2k entities, 600 churn ticks), ms per session\n";
+    for (int sessions : {1, 8, 32}) {
+        int rounds = 64 / sessions;
+        Cost heap = ms_per_session(false, sessions, rounds);
+        Cost arena = ms_per_session(true, sessions, rounds);
+
+        std::cout << "  " << sessions << " concurrent sessions:"
+                  << " create heap " << heap.open << ", arena " << arena.open
+                  << " | churn heap " << heap.churn << ", arena " << arena.churn
+                  << " | destroy heap " << heap.close << ", arena " << arena.close << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_registry_snapshot
+*/
+
+// Cost of Registry::save_snapshot / load_snapshot on a registry shaped like
+// a busy R-Type session (2,000 entities: players, enemies, projectiles,
+// walls). The target is to stay well under 1 ms so it can run every tick.
+
+#include "ecs/Registry.hpp"
+#include "ecs/CoreComponents.hpp"
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+struct BenchHealth {
+    int current = 100;
+    int max = 100;
+};
+
+struct BenchAI {
+    int type = 0;
+    float timer = 0.0f;
+    float target_x = 0.0f;
+    float target_y = 0.0f;
+};
+
+struct BenchProjectile {
+    int faction = 0;
+    float damage = 10.0f;
+    float lifetime = 3.0f;
+};
+
+}
+
+ECS_SNAPSHOT_COMPONENT(BenchHealth);
+ECS_SNAPSHOT_COMPONENT(BenchAI);
+ECS_SNAPSHOT_COMPONENT(BenchProjectile);
+
+namespace {
+
+void populate(Registry& registry, size_t count)
+{
+    registry.register_component<Position>();
+    registry.register_component<Velocity>();
+    registry.register_component<Collider>();
+    registry.register_component<Sprite>();
+    registry.register_component<Controllable>();
+    registry.register_component<NoFriction>();
+    registry.register_component<ToDestroy>();
+    registry.register_component<BenchHealth>();
+    registry.register_component<BenchAI>();
+    registry.register_component<BenchProjectile>();
+
+    for (size_t i = 0; i < count; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component(e, Position{static_cast<float>(i), 0.0f});
+        registry.add_component(e, Velocity{-1.0f, 0.0f});
+        registry.add_component(e, Collider{16.0f, 16.0f});
+        registry.add_component(e, Sprite{});
+        if (i < 4) {
+            registry.add_component(e, Controllable{});
+            registry.add_component(e, BenchHealth{});
+        } else if (i % 3 == 0) {
+            registry.add_component(e, BenchAI{});
+            registry.add_component(e, BenchHealth{});
+        } else {
+            registry.add_component(e, BenchProjectile{});
+            registry.add_component(e, NoFriction{});
+        }
+    }
+}
+
+}
+
+int main()
+{
+    constexpr size_t ENTITIES = 2000;
+    constexpr int ITERATIONS = 2000;
+    Registry registry;
+    std::vector<uint8_t> blob;
+
+    populate(registry, ENTITIES);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        blob.clear();
+        registry.save_snapshot(blob);
+    }
+    auto after_save = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+        registry.load_snapshot(blob);
+    auto after_load = std::chrono::high_resolution_clock::now();
+
+    auto us = [](auto a, auto b) {
+        return std::chrono::duration<double, std::micro>(b - a).count() / ITERATIONS;
+    };
+    std::cout << "Registry snapshot, " << ENTITIES << " entities\n"
+              << "  blob: " << blob.size() / 1024.0 << " KiB\n"
+              << "  save: " << us(start, after_save) << " us\n"
+              << "  load: " << us(after_save, after_load) << " us\n";
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_sparseset_layout
+*/
+
+// Compares the paged SparseSet sparse index against the previous flat
+// std::vector<std::optional<size_t>> layout: memory held by the sparse
+// index and lookup/insert/erase throughput for a few live entities
+// scattered under a high entity id watermark.
+
+#include "ecs/SparseSet.hpp"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Payload {
+    float x, y;
+};
+
+// Previous SparseSet layout, kept here only as the comparison baseline
+template <typename Component>
+class FlatSparseSet {
+    public:
+        bool has_entity(size_t id) const {
+            return id < sparse.size() && sparse[id].has_value();
+        }
+
+        Component& operator[](size_t id) {
+            return data[sparse[id].value()];
+        }
+
+        void insert_at(size_t id, const Component& component) {
+            if (id >= sparse.size()) sparse.resize(id + 1);
+            dense.push_back(id);
+            data.push_back(component);
+            sparse[id] = dense.size() - 1;
+        }
+
+        void erase(size_t id) {
+            if (!has_entity(id)) return;
+            size_t delete_id = sparse[id].value();
+            size_t last = dense.back();
+            dense[delete_id] = last;
+            dense.pop_back();
+            data[delete_id] = data.back();
+            data.pop_back();
+            sparse[last] = delete_id;
+            sparse[id].reset();
+        }
+
+        size_t sparse_memory_usage() const {
+            return sparse.capacity() * sizeof(std::optional<size_t>);
+        }
+
+    private:
+        std::vector<std::optional<size_t>> sparse;
+        std::vector<size_t> dense;
+        std::vector<Component> data;
+};
+
+template <typename Set>
+void run(const char* name, const std::vector<size_t>& ids, int lookups)
+{
+    Set set;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t id : ids)
+        set.insert_at(id, Payload{1.0f, 2.0f});
+    auto after_insert = std::chrono::high_resolution_clock::now();
+
+    float sum = 0.0f;
+    for (int pass = 0; pass < lookups; pass++)
+        for (size_t id : ids)
+            if (set.has_entity(id))
+                sum += set[id].x;
+    auto after_lookup = std::chrono::high_resolution_clock::now();
+
+    for (size_t id : ids)
+        set.erase(id);
+    auto after_erase = std::chrono::high_resolution_clock::now();
+
+    auto us = [](auto a, auto b) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(b - a).count();
+    };
+    std::cout << "  " << name
+              << " | sparse: " << set.sparse_memory_usage() / 1024 << " KiB"
+              << " | insert: " << us(start, after_insert) << " us"
+              << " | lookup: " << us(after_insert, after_lookup) << " us"
+              << " | erase: " << us(after_lookup, after_erase) << " us"
+              << " (checksum " << sum << ")\n";
+}
+
+void scenario(size_t live, size_t watermark, int lookups)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> dist(0, watermark);
+    std::vector<size_t> ids;
+    std::vector<bool> used(watermark + 1, false);
+
+    while (ids.size() < live) {
+        size_t id = dist(rng);
+        if (!used[id]) {
+            used[id] = true;
+            ids.push_back(id);
+        }
+    }
+    std::cout << "\nLive: " << live << " | Id watermark: " << watermark
+              << " | Lookup passes: " << lookups << "\n";
+    run<FlatSparseSet<Payload>>("flat optional", ids, lookups);
+    run<SparseSet<Payload>>("paged uint32 ", ids, lookups);
+}
+
+}
+
+int main()
+{
+    std::cout << "SparseSet sparse index layout comparison\n";
+    scenario(500, 10000, 1000);
+    scenario(500, 1000000, 1000);
+    scenario(5000, 4000000, 100);
+    scenario(100000, 100000, 10);
+    return 0;
+}
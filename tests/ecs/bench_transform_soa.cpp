@@ -0,0 +1,111 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_transform_soa
+*/
+
+// Per-entity cost of PhysiqueSystem (integration, friction, screen clamping)
+// with its per-entity loop over the Position/Velocity group against
+// ecs::TransformSoA, at 1k/10k/100k entities. "SoA copy in/out" copies the
+// group into the arrays and back on every tick; "kernels only" keeps the
+// data in SoA layout across ticks, the only way the kernels pay off.
+
+#include "ecs/Registry.hpp"
+#include "ecs/CoreComponents.hpp"
+#include "ecs/TransformSoA.hpp"
+#include "ecs/systems/PhysiqueSystem.hpp"
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+// Un tick complet avec copie du groupe vers la SoA et retour
+void copy_in_out(Registry& registry, ecs::TransformSoA& soa, float dt)
+{
+    auto& controllables = registry.get_components<Controllable>();
+    auto& noFrictions = registry.get_components<NoFriction>();
+    auto& positions = registry.get_components<Position>();
+    auto& velocities = registry.get_components<Velocity>();
+    // Les membres du groupe occupent [0, size()) des deux pools, dans le même ordre
+    size_t count = registry.group<Position, Velocity>().size();
+    const std::pmr::vector<Entity>& entities = positions.entities();
+
+    soa.resize(count);
+    soa.load(positions.raw(), velocities.raw());
+    for (size_t i = 0; i < count; ++i) {
+        Entity entity = entities[i];
+        soa.set_friction(i, noFrictions.has_entity(entity) ? 1.0f : 0.98f);
+        soa.set_clamped(i, controllables.has_entity(entity));
+    }
+    soa.integrate(dt);
+    soa.apply_friction();
+    soa.clamp(rtype::shared::config::SCREEN_WIDTH, rtype::shared::config::SCREEN_HEIGHT);
+    soa.store(positions.raw(), velocities.raw());
+}
+
+void populate(Registry& registry, size_t count)
+{
+    registry.register_component<Position>();
+    registry.register_component<Velocity>();
+    registry.register_component<Controllable>();
+    registry.register_component<NoFriction>();
+    registry.group<Position, Velocity>();
+
+    for (size_t i = 0; i < count; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component(e, Position{static_cast<float>(i % 1920), static_cast<float>(i % 1080)});
+        registry.add_component(e, Velocity{-300.0f, 10.0f});
+        // Quelques joueurs, beaucoup de projectiles sans friction
+        if (i % 64 == 0)
+            registry.add_component(e, Controllable{});
+        else if (i % 2 == 0)
+            registry.add_component(e, NoFriction{});
+    }
+}
+
+template <typename Func>
+double ns_per_entity(size_t count, int iterations, Func&& func)
+{
+    // Tour de chauffe : caches et tampons SoA à leur taille
+    func();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+        func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations / count;
+}
+
+}
+
+int main()
+{
+    std::cout << "PhysiqueSystem update, ns per entity\n";
+    for (size_t count : {1000, 10000, 100000}) {
+        // Peu de ticks : la friction ne doit pas amener les vitesses aux dénormaux
+        int iterations = static_cast<int>(2000000 / count);
+        Registry scalarRegistry;
+        Registry soaRegistry;
+        PhysiqueSystem scalar;
+        ecs::TransformSoA soa;
+        ecs::TransformSoA kernels;
+
+        populate(scalarRegistry, count);
+        populate(soaRegistry, count);
+        kernels.resize(count);
+        kernels.load(soaRegistry.get_components<Position>().raw(), soaRegistry.get_components<Velocity>().raw());
+
+        double scalarCost = ns_per_entity(count, iterations, [&] { scalar.update(scalarRegistry, 0.016f); });
+        double soaCost = ns_per_entity(count, iterations, [&] { copy_in_out(soaRegistry, soa, 0.016f); });
+        double kernelCost = ns_per_entity(count, iterations, [&] {
+            kernels.integrate(0.016f);
+            kernels.apply_friction();
+            kernels.clamp(1920.0f, 1080.0f);
+        });
+
+        std::cout << "  " << count << " entities: scalar " << scalarCost
+                  << ", SoA (copy in/out) " << soaCost
+                  << ", kernels only " << kernelCost << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** bench_view_iteration
+*/
+
+// Per-entity cost of the PhysiqueSystem integration loop written the old way
+// (walk Velocity, has_entity + operator[] on Position and Velocity) against
+// Registry::view<Position, Velocity>() and the owning
+// Registry::group<Position, Velocity>() (aligned dense arrays).
+
+#include "ecs/Registry.hpp"
+#include "ecs/CoreComponents.hpp"
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+void populate(Registry& registry, size_t count)
+{
+    registry.register_component<Position>();
+    registry.register_component<Velocity>();
+    for (size_t i = 0; i < count; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component(e, Velocity{1.0f, 1.0f});
+        // One entity in four has no Position (velocity-only entities are skipped)
+        if (i % 4 != 0)
+            registry.add_component(e, Position{static_cast<float>(i), 0.0f});
+    }
+}
+
+void hand_rolled(Registry& registry, float dt)
+{
+    auto& positions = registry.get_components<Position>();
+    auto& velocities = registry.get_components<Velocity>();
+
+    for (size_t i = 0; i < velocities.size(); i++) {
+        Entity entity = velocities.get_entity_at(i);
+        if (!positions.has_entity(entity))
+            continue;
+        auto& pos = positions[entity];
+        auto& vel = velocities[entity];
+        pos.x += vel.x * dt;
+        pos.y += vel.y * dt;
+    }
+}
+
+void with_view(Registry& registry, float dt)
+{
+    registry.view<Position, Velocity>().each([dt](Position& pos, Velocity& vel) {
+        pos.x += vel.x * dt;
+        pos.y += vel.y * dt;
+    });
+}
+
+void with_group(Registry& registry, float dt)
+{
+    registry.group<Position, Velocity>().each([dt](Position& pos, Velocity& vel) {
+        pos.x += vel.x * dt;
+        pos.y += vel.y * dt;
+    });
+}
+
+template <typename Loop>
+void run(const char* name, size_t count, int frames, Loop loop)
+{
+    Registry registry;
+    populate(registry, count);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int f = 0; f < frames; f++)
+        loop(registry, 0.016f);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "  " << name << " | " << ns / (static_cast<double>(frames) * count) << " ns/entity\n";
+}
+
+}
+
+int main()
+{
+    for (size_t count : {1000, 10000, 100000}) {
+        int frames = static_cast<int>(10000000 / count);
+        std::cout << "\nEntities: " << count << " | Frames: " << frames << "\n";
+        run("has_entity + operator[]", count, frames, hand_rolled);
+        run("view<Position, Velocity>", count, frames, with_view);
+        run("group<Position, Velocity>", count, frames, with_group);
+    }
+    return 0;
+}
@@ -9,7 +9,9 @@
 #include "ecs/Registry.hpp"
 #include "components/GameComponents.hpp"
 #include "ecs/systems/PhysiqueSystem.hpp"
+#include "ecs/TransformSoA.hpp"
 #include <cmath>
+#include <vector>
 
 // Helper function to compare floats with tolerance
 bool is_approx(float a, float b, float epsilon = 0.001f) {
@@ -541,6 +543,89 @@ TEST_F(PhysiqueSystemTest, ZeroDeltaTime) {
     EXPECT_TRUE(is_approx(velocity.y, initialVelY * 0.98f, 0.1f));
 }
 
+// ============================================================================
+// STRUCTURE-OF-ARRAYS PATH
+// ============================================================================
+
+// Mixed population: players (clamped), projectiles (no friction), enemies
+static void populate_mixed(Registry& registry, size_t count) {
+    registry.register_component<Position>();
+    registry.register_component<Velocity>();
+    registry.register_component<Controllable>();
+    registry.register_component<NoFriction>();
+    registry.group<Position, Velocity>();
+
+    for (size_t i = 0; i < count; i++) {
+        Entity e = registry.spawn_entity();
+        float fi = static_cast<float>(i);
+        registry.add_component(e, Position{fi * 37.0f - 200.0f, fi * 11.0f - 50.0f});
+        registry.add_component(e, Velocity{(fi - 20.0f) * 45.0f, (10.0f - fi) * 33.0f});
+        if (i % 5 == 0)
+            registry.add_component(e, Controllable{});
+        if (i % 3 == 0)
+            registry.add_component(e, NoFriction{});
+    }
+}
+
+TEST(PhysiqueSystemSoATest, KernelsKeptAcrossTicksMatchPhysiqueSystem) {
+    Registry registry;
+    PhysiqueSystem physiqueSystem;
+    ecs::TransformSoA soa;
+
+    // 37 : ni multiple de 4 ni de 8, les lanes de remplissage sont exercées
+    populate_mixed(registry, 37);
+    auto& positions = registry.get_components<Position>();
+    auto& velocities = registry.get_components<Velocity>();
+    auto& controllables = registry.get_components<Controllable>();
+    auto& noFrictions = registry.get_components<NoFriction>();
+    size_t count = registry.group<Position, Velocity>().size();
+
+    // Chargé une fois, puis les données restent en SoA pendant tous les ticks
+    soa.resize(count);
+    soa.load(positions.raw(), velocities.raw());
+    for (size_t i = 0; i < count; i++) {
+        Entity e = positions.get_entity_at(i);
+        soa.set_friction(i, noFrictions.has_entity(e) ? 1.0f : 0.98f);
+        soa.set_clamped(i, controllables.has_entity(e));
+    }
+    for (int tick = 0; tick < 30; tick++) {
+        physiqueSystem.update(registry, 0.016f);
+        soa.integrate(0.016f);
+        soa.apply_friction();
+        soa.clamp(rtype::shared::config::SCREEN_WIDTH, rtype::shared::config::SCREEN_HEIGHT);
+    }
+
+    std::vector<Position> soaPositions(count);
+    std::vector<Velocity> soaVelocities(count);
+    soa.store(soaPositions.data(), soaVelocities.data());
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_FLOAT_EQ(positions.raw()[i].x, soaPositions[i].x);
+        EXPECT_FLOAT_EQ(positions.raw()[i].y, soaPositions[i].y);
+        EXPECT_FLOAT_EQ(velocities.raw()[i].x, soaVelocities[i].x);
+        EXPECT_FLOAT_EQ(velocities.raw()[i].y, soaVelocities[i].y);
+    }
+}
+
+TEST(PhysiqueSystemSoATest, KernelsClampOnlyMaskedLanes) {
+    ecs::TransformSoA soa;
+    Position positions[3] = {{-10.0f, -10.0f}, {5000.0f, 5000.0f}, {-10.0f, 5000.0f}};
+    Velocity velocities[3] = {{0.0f, 0.0f}, {0.0f, 0.0f}, {0.0f, 0.0f}};
+
+    soa.resize(3);
+    soa.load(positions, velocities);
+    soa.set_clamped(0, true);
+    soa.set_clamped(1, true);
+    soa.clamp(800.0f, 600.0f);
+    soa.store(positions, velocities);
+
+    EXPECT_FLOAT_EQ(positions[0].x, 0.0f);
+    EXPECT_FLOAT_EQ(positions[0].y, 0.0f);
+    EXPECT_FLOAT_EQ(positions[1].x, 800.0f);
+    EXPECT_FLOAT_EQ(positions[1].y, 600.0f);
+    EXPECT_FLOAT_EQ(positions[2].x, -10.0f);
+    EXPECT_FLOAT_EQ(positions[2].y, 5000.0f);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -7,7 +7,11 @@
 
 #include <gtest/gtest.h>
 #include "ecs/Registry.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory_resource>
 #include <string>
+#include <vector>
 
 // Test Components
 struct Position {
@@ -38,6 +42,11 @@ struct Health {
     }
 };
 
+// Position, Velocity and Health take part in snapshots, Name (std::string) does not
+ECS_SNAPSHOT_COMPONENT(Position);
+ECS_SNAPSHOT_COMPONENT(Velocity);
+ECS_SNAPSHOT_COMPONENT(Health);
+
 // ============================================================================
 // REGISTRY TESTS
 // ============================================================================
@@ -143,6 +152,9 @@ TEST_F(RegistryTest, AddComponent_MultipleDifferentEntities) {
 }
 
 TEST_F(RegistryTest, AddComponent_NonSequentialEntityIDs) {
+    // Seules des entités vivantes reçoivent des composants
+    for (int i = 0; i <= 100; i++)
+        registry.spawn_entity();
     Entity e5 = 5;
     Entity e10 = 10;
     Entity e100 = 100;
@@ -361,6 +373,1077 @@ TEST_F(RegistryTest, EdgeCase_AccessComponentOnDeadEntity) {
     EXPECT_THROW(positions[entity], std::bad_optional_access);
 }
 
+// -----------------------------------------------
+// TEST SUITE 8: Generational Handles
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Generation_KilledSlotIsRecycled) {
+    Entity e1 = registry.spawn_entity();
+    registry.spawn_entity();
+
+    registry.kill_entity(e1);
+    Entity e3 = registry.spawn_entity();
+
+    EXPECT_EQ(ecs::entity::index(e3), ecs::entity::index(e1));
+    EXPECT_NE(e3, e1);
+    EXPECT_EQ(registry.entity_capacity(), 2u);
+}
+
+TEST_F(RegistryTest, Generation_StaleHandleIsRejected) {
+    Entity old_entity = registry.spawn_entity();
+    registry.add_component<Position>(old_entity, Position{1.0f, 1.0f});
+    registry.kill_entity(old_entity);
+
+    Entity new_entity = registry.spawn_entity();
+    registry.add_component<Position>(new_entity, Position{2.0f, 2.0f});
+
+    auto& positions = registry.get_components<Position>();
+    EXPECT_FALSE(registry.is_alive(old_entity));
+    EXPECT_TRUE(registry.is_alive(new_entity));
+    EXPECT_FALSE(positions.has_entity(old_entity));
+    EXPECT_THROW(positions[old_entity], std::bad_optional_access);
+    EXPECT_EQ(positions[new_entity].x, 2.0f);
+
+    // Removing through the stale handle must not touch the new owner
+    registry.remove_component<Position>(old_entity);
+    EXPECT_TRUE(positions.has_entity(new_entity));
+}
+
+TEST_F(RegistryTest, Generation_AddAfterKillIsIgnored) {
+    Entity e = registry.spawn_entity();
+    registry.kill_entity(e);
+
+    registry.add_component<Position>(e, Position{1.0f, 1.0f});
+    Entity batch[] = {e};
+    registry.add_components(batch, 1, Velocity{1.0f, 1.0f});
+    EXPECT_THROW(registry.emplace_component<Position>(e, 1.0f, 1.0f), std::logic_error);
+
+    EXPECT_EQ(registry.get_components<Position>().size(), 0u);
+    EXPECT_EQ(registry.get_components<Velocity>().size(), 0u);
+    // Le slot recyclé repart sans composant ni bit de signature
+    Entity recycled = registry.spawn_entity();
+    registry.add_component<Velocity>(recycled, Velocity{1.0f, 1.0f});
+    EXPECT_FALSE(registry.get_components<Position>().has_entity(recycled));
+    EXPECT_TRUE(registry.observer<Velocity>(ecs::exclude<Position>).contains(recycled));
+}
+
+TEST_F(RegistryTest, Generation_AddThroughStaleHandleKeepsNewOwner) {
+    Entity c = registry.spawn_entity();
+    registry.kill_entity(c);
+    Entity d = registry.spawn_entity();
+    ASSERT_EQ(ecs::entity::index(c), ecs::entity::index(d));
+
+    registry.add_component<Position>(d, Position{2.0f, 2.0f});
+    registry.add_component<Position>(c, Position{9.0f, 9.0f});
+
+    auto& positions = registry.get_components<Position>();
+    EXPECT_TRUE(positions.has_entity(d));
+    EXPECT_FALSE(positions.has_entity(c));
+    EXPECT_EQ(positions.size(), 1u);
+    EXPECT_EQ(positions[d].x, 2.0f);
+    // Directement sur le SparseSet, un autre handle du slot n'écrase pas l'occupant
+    EXPECT_THROW(positions.insert_at(c, Position{9.0f, 9.0f}), std::logic_error);
+    EXPECT_EQ(positions[d].x, 2.0f);
+}
+
+TEST_F(RegistryTest, Generation_DoubleKillDoesNotDuplicateSlot) {
+    Entity e = registry.spawn_entity();
+
+    registry.kill_entity(e);
+    registry.kill_entity(e);
+
+    Entity a = registry.spawn_entity();
+    Entity b = registry.spawn_entity();
+    EXPECT_NE(ecs::entity::index(a), ecs::entity::index(b));
+}
+
+TEST_F(RegistryTest, Generation_ChurnKeepsMemoryFlat) {
+    for (int i = 0; i < 10000; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{0.0f, 0.0f});
+        registry.kill_entity(e);
+    }
+
+    EXPECT_EQ(registry.entity_capacity(), 1u);
+    EXPECT_EQ(registry.get_components<Position>().size(), 0u);
+}
+
+TEST_F(RegistryTest, Generation_NetworkIdFitsProtocol) {
+    Entity e = ecs::entity::make(42, 0);
+    EXPECT_EQ(ecs::entity::to_network_id(e), 42u);
+
+    Entity recycled = ecs::entity::make(42, 3);
+    EXPECT_NE(ecs::entity::to_network_id(recycled), ecs::entity::to_network_id(e));
+    EXPECT_EQ(ecs::entity::to_network_id(recycled) & ecs::entity::NETWORK_INDEX_MASK, 42u);
+}
+
+// -----------------------------------------------
+// TEST SUITE 9: Views
+// -----------------------------------------------
+
+TEST_F(RegistryTest, View_VisitsOnlyEntitiesWithAllComponents) {
+    Entity both = registry.spawn_entity();
+    Entity only_pos = registry.spawn_entity();
+    Entity only_vel = registry.spawn_entity();
+
+    registry.add_component<Position>(both, Position{1.0f, 1.0f});
+    registry.add_component<Velocity>(both, Velocity{2.0f, 2.0f});
+    registry.add_component<Position>(only_pos, Position{3.0f, 3.0f});
+    registry.add_component<Velocity>(only_vel, Velocity{4.0f, 4.0f});
+
+    std::vector<Entity> visited;
+    registry.view<Position, Velocity>().each([&](Entity e, Position& pos, Velocity& vel) {
+        visited.push_back(e);
+        pos.x += vel.x;
+    });
+
+    ASSERT_EQ(visited.size(), 1u);
+    EXPECT_EQ(visited[0], both);
+    EXPECT_EQ(registry.get_components<Position>()[both].x, 3.0f);
+}
+
+TEST_F(RegistryTest, View_ExcludeFiltersEntities) {
+    Entity named = registry.spawn_entity();
+    Entity anonymous = registry.spawn_entity();
+
+    registry.add_component<Position>(named, Position{0.0f, 0.0f});
+    registry.add_component<Name>(named, Name{"Named"});
+    registry.add_component<Position>(anonymous, Position{0.0f, 0.0f});
+
+    std::vector<Entity> visited;
+    registry.view<Position>(ecs::exclude<Name>).each([&](Entity e, Position&) {
+        visited.push_back(e);
+    });
+
+    ASSERT_EQ(visited.size(), 1u);
+    EXPECT_EQ(visited[0], anonymous);
+    EXPECT_FALSE(registry.view<Position>(ecs::exclude<Name>).contains(named));
+}
+
+TEST_F(RegistryTest, View_DrivenBySmallestPool) {
+    for (int i = 0; i < 100; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{0.0f, 0.0f});
+        if (i % 10 == 0)
+            registry.add_component<Health>(e, Health{i});
+    }
+
+    auto view = registry.view<Position, Health>();
+    EXPECT_EQ(view.size_hint(), 10u);
+
+    int count = 0;
+    view.each([&](Position&, Health&) { count++; });
+    EXPECT_EQ(count, 10);
+}
+
+TEST_F(RegistryTest, View_KillDuringIterationIsSafe) {
+    for (int i = 0; i < 10; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+        registry.add_component<Health>(e, Health{i});
+    }
+
+    int visited = 0;
+    registry.view<Position, Health>().each([&](Entity e, Position&, Health& hp) {
+        visited++;
+        if (hp.hp % 2 == 0)
+            registry.kill_entity(e);
+    });
+
+    EXPECT_EQ(visited, 10);
+    EXPECT_EQ(registry.get_components<Position>().size(), 5u);
+    EXPECT_EQ(registry.get_components<Health>().size(), 5u);
+}
+
+// -----------------------------------------------
+// TEST SUITE 10: Owning Groups
+// -----------------------------------------------
+
+static void expect_group_aligned(Registry& registry, size_t expected)
+{
+    auto& positions = registry.get_components<Position>();
+    auto& velocities = registry.get_components<Velocity>();
+
+    ASSERT_EQ((registry.group<Position, Velocity>().size()), expected);
+    for (size_t i = 0; i < expected; i++) {
+        EXPECT_EQ(positions.get_entity_at(i), velocities.get_entity_at(i));
+        EXPECT_EQ(positions.get_data_at(i).x, velocities.get_data_at(i).x);
+    }
+}
+
+TEST_F(RegistryTest, Group_AlignsExistingAndNewEntities) {
+    for (int i = 0; i < 20; i++) {
+        Entity e = registry.spawn_entity();
+        if (i % 3 != 0)
+            registry.add_component<Velocity>(e, Velocity{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0)
+            registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+    }
+
+    // i pair et non multiple de 3 : 2, 4, 8, 10, 14, 16
+    registry.group<Position, Velocity>();
+    expect_group_aligned(registry, 6);
+
+    Entity late = registry.spawn_entity();
+    registry.add_component<Velocity>(late, Velocity{42.0f, 0.0f});
+    expect_group_aligned(registry, 6);
+    registry.add_component<Position>(late, Position{42.0f, 0.0f});
+    expect_group_aligned(registry, 7);
+}
+
+TEST_F(RegistryTest, Group_RemoveAndKillKeepAlignment) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 10; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+        registry.add_component<Velocity>(e, Velocity{static_cast<float>(i), 0.0f});
+        entities.push_back(e);
+    }
+    registry.group<Position, Velocity>();
+
+    registry.remove_component<Velocity>(entities[0]);
+    registry.kill_entity(entities[5]);
+    expect_group_aligned(registry, 8);
+    EXPECT_FALSE((registry.group<Position, Velocity>().contains(entities[0])));
+    EXPECT_TRUE(registry.get_components<Position>().has_entity(entities[0]));
+
+    registry.add_component<Velocity>(entities[0], Velocity{0.0f, 0.0f});
+    expect_group_aligned(registry, 9);
+}
+
+TEST_F(RegistryTest, Group_EachVisitsMembersAndAllowsKill) {
+    for (int i = 0; i < 10; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+        if (i < 6)
+            registry.add_component<Velocity>(e, Velocity{static_cast<float>(i), 0.0f});
+    }
+
+    int visited = 0;
+    registry.group<Position, Velocity>().each([&](Entity e, Position& pos, Velocity& vel) {
+        visited++;
+        EXPECT_EQ(pos.x, vel.x);
+        if (static_cast<int>(pos.x) % 2 == 0)
+            registry.kill_entity(e);
+    });
+
+    EXPECT_EQ(visited, 6);
+    expect_group_aligned(registry, 3);
+}
+
+TEST_F(RegistryTest, Group_PoolOwnedByAnotherGroupThrows) {
+    registry.group<Position, Velocity>();
+
+    EXPECT_THROW((registry.group<Position, Health>()), std::logic_error);
+    EXPECT_NO_THROW((registry.group<Name, Health>()));
+}
+
+// -----------------------------------------------
+// TEST SUITE 11: Component Signatures
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Signature_KillRemovesOwnedComponentsOnly) {
+    Entity bullet = registry.spawn_entity();
+    Entity other = registry.spawn_entity();
+
+    registry.add_component<Position>(bullet, Position{1.0f, 1.0f});
+    registry.add_component<Velocity>(bullet, Velocity{1.0f, 1.0f});
+    registry.add_component<Position>(other, Position{2.0f, 2.0f});
+    registry.add_component<Health>(other, Health{10});
+
+    registry.kill_entity(bullet);
+    Entity recycled = registry.spawn_entity();
+
+    EXPECT_FALSE(registry.get_components<Position>().has_entity(recycled));
+    EXPECT_FALSE(registry.get_components<Velocity>().has_entity(recycled));
+    EXPECT_EQ(registry.get_components<Position>()[other].x, 2.0f);
+    EXPECT_EQ(registry.get_components<Health>()[other].hp, 10);
+    EXPECT_FALSE((registry.view<Position, Velocity>().contains(recycled)));
+}
+
+TEST_F(RegistryTest, Signature_ViewTracksRemovedComponent) {
+    Entity e = registry.spawn_entity();
+    registry.add_component<Position>(e, Position{0.0f, 0.0f});
+    registry.add_component<Velocity>(e, Velocity{0.0f, 0.0f});
+    EXPECT_TRUE((registry.view<Position, Velocity>().contains(e)));
+
+    registry.remove_component<Velocity>(e);
+    int visited = 0;
+    registry.view<Position, Velocity>().each([&](Position&, Velocity&) { visited++; });
+
+    EXPECT_EQ(visited, 0);
+    EXPECT_FALSE((registry.view<Position, Velocity>().contains(e)));
+    EXPECT_TRUE(registry.view<Position>(ecs::exclude<Velocity>).contains(e));
+}
+
+TEST_F(RegistryTest, Signature_ReRegisterClearsComponent) {
+    Entity e = registry.spawn_entity();
+    registry.add_component<Position>(e, Position{0.0f, 0.0f});
+    registry.add_component<Name>(e, Name{"tagged"});
+
+    registry.register_component<Name>();
+
+    EXPECT_TRUE(registry.view<Position>(ecs::exclude<Name>).contains(e));
+    EXPECT_NO_THROW(registry.kill_entity(e));
+    EXPECT_EQ(registry.get_components<Position>().size(), 0u);
+}
+
+// -----------------------------------------------
+// TEST SUITE 12: Command Buffer
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Commands_AreDeferredUntilFlush) {
+    ecs::CommandBuffer& commands = registry.commands();
+    Entity pending = commands.spawn();
+    commands.add(pending, Position{1.0f, 2.0f});
+    commands.emplace<Velocity>(pending, 3.0f, 4.0f);
+
+    EXPECT_TRUE(ecs::CommandBuffer::is_pending(pending));
+    EXPECT_EQ(registry.get_components<Position>().size(), 0u);
+
+    registry.flush_commands();
+
+    auto& positions = registry.get_components<Position>();
+    ASSERT_EQ(positions.size(), 1u);
+    Entity spawned = positions.get_entity_at(0);
+    EXPECT_TRUE(registry.is_alive(spawned));
+    EXPECT_EQ(positions[spawned].y, 2.0f);
+    EXPECT_EQ(registry.get_components<Velocity>()[spawned].x, 3.0f);
+    EXPECT_TRUE(commands.empty());
+}
+
+TEST_F(RegistryTest, Commands_AppliedInRecordingOrder) {
+    Entity e = registry.spawn_entity();
+    registry.add_component<Health>(e, Health{10});
+    Entity doomed = registry.spawn_entity();
+    registry.add_component<Health>(doomed, Health{5});
+
+    ecs::CommandBuffer& commands = registry.commands();
+    commands.remove<Health>(e);
+    commands.add(e, Health{20});
+    commands.add(doomed, Name{"ghost"});
+    commands.kill(doomed);
+    registry.flush_commands();
+
+    EXPECT_EQ(registry.get_components<Health>()[e].hp, 20);
+    EXPECT_FALSE(registry.is_alive(doomed));
+    EXPECT_EQ(registry.get_components<Name>().size(), 0u);
+}
+
+TEST_F(RegistryTest, Commands_AfterKillAreDropped) {
+    Entity e = registry.spawn_entity();
+    registry.add_component<Health>(e, Health{10});
+
+    ecs::CommandBuffer& commands = registry.commands();
+    commands.kill(e);
+    commands.add(e, Name{"ghost"});
+    commands.remove<Health>(e);
+    registry.flush_commands();
+    EXPECT_EQ(registry.get_components<Name>().size(), 0u);
+
+    // Tué par un flush précédent, slot déjà repris : le nouvel occupant est intact
+    Entity reused = registry.spawn_entity();
+    ASSERT_EQ(ecs::entity::index(reused), ecs::entity::index(e));
+    registry.add_component<Health>(reused, Health{7});
+    commands.add(e, Health{99});
+    commands.remove<Health>(e);
+    registry.flush_commands();
+
+    EXPECT_EQ(registry.get_components<Health>().size(), 1u);
+    EXPECT_EQ(registry.get_components<Health>()[reused].hp, 7);
+}
+
+TEST_F(RegistryTest, Commands_RecordedDuringViewAreSafe) {
+    for (int i = 0; i < 10; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+    }
+
+    int visited = 0;
+    registry.view<Position>().each([&](Entity e, Position& pos) {
+        visited++;
+        Entity child = registry.commands().spawn();
+        registry.commands().add(child, Position{pos.x, 1.0f});
+        registry.commands().kill(e);
+    });
+    registry.flush_commands();
+
+    EXPECT_EQ(visited, 10);
+    EXPECT_EQ(registry.get_components<Position>().size(), 10u);
+    registry.view<Position>().each([](Position& pos) { EXPECT_EQ(pos.y, 1.0f); });
+}
+
+class SpawnerSystem : public ISystem {
+    public:
+        void init(Registry&) override {}
+        void shutdown() override {}
+        void update(Registry& registry, float) override
+        {
+            registry.commands().add(registry.commands().spawn(), Health{1});
+        }
+};
+
+class HealthCounterSystem : public ISystem {
+    public:
+        size_t seen = 0;
+        void init(Registry&) override {}
+        void shutdown() override {}
+        void update(Registry& registry, float) override
+        {
+            seen = registry.get_components<Health>().size();
+        }
+};
+
+TEST_F(RegistryTest, Commands_FlushedBetweenSystems) {
+    registry.register_system<SpawnerSystem>();
+    registry.register_system<HealthCounterSystem>();
+
+    registry.run_systems(0.016f);
+    EXPECT_EQ(registry.get_system<HealthCounterSystem>().seen, 1u);
+    registry.run_systems(0.016f);
+    EXPECT_EQ(registry.get_system<HealthCounterSystem>().seen, 2u);
+}
+
+// -----------------------------------------------
+// TEST SUITE 13: Change Tracking
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Changes_ConsumerSeesOnlyNewChanges) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 5; i++) {
+        entities.push_back(registry.spawn_entity());
+        registry.add_component(entities.back(), Health{100});
+    }
+
+    auto changed = [this](uint32_t since) {
+        std::vector<Entity> result;
+        registry.get_components<Health>().changed_since(since, [&](Entity e, Health&) { result.push_back(e); });
+        return result;
+    };
+
+    uint32_t last = registry.advance_change_tick();
+    EXPECT_EQ(changed(0).size(), 5u);
+    EXPECT_TRUE(changed(last).empty());
+
+    registry.patch<Health>(entities[2], [](Health& health) { health.hp -= 10; });
+    uint32_t since = last;
+    last = registry.advance_change_tick();
+    EXPECT_EQ(changed(since), (std::vector<Entity>{entities[2]}));
+    EXPECT_EQ(registry.get_components<Health>()[entities[2]].hp, 90);
+    EXPECT_TRUE(changed(last).empty());
+}
+
+// -----------------------------------------------
+// TEST SUITE 14: Snapshots
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Snapshot_RestoresComponentsAndAllocator) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 6; i++) {
+        entities.push_back(registry.spawn_entity());
+        registry.add_component(entities.back(), Position{static_cast<float>(i), 0.0f});
+        registry.add_component(entities.back(), Health{100});
+    }
+    registry.kill_entity(entities[1]);
+    std::vector<uint8_t> blob = registry.save_snapshot();
+
+    // La partie continue puis revient en arrière
+    registry.kill_entity(entities[4]);
+    Entity late = registry.spawn_entity();
+    registry.add_component(late, Position{99.0f, 99.0f});
+    registry.get_components<Position>()[entities[0]].x = -1.0f;
+    registry.load_snapshot(blob);
+
+    EXPECT_FALSE(registry.is_alive(entities[1]));
+    EXPECT_TRUE(registry.is_alive(entities[4]));
+    EXPECT_FALSE(registry.is_alive(late));
+    EXPECT_EQ(registry.get_components<Position>().size(), 5u);
+    EXPECT_EQ(registry.get_components<Position>()[entities[0]].x, 0.0f);
+    EXPECT_EQ(registry.get_components<Health>()[entities[4]].hp, 100);
+    EXPECT_EQ((registry.view<Position, Health>().size_hint()), 5u);
+    // Le slot libéré est recyclé comme avant la sauvegarde
+    EXPECT_EQ(ecs::entity::index(registry.spawn_entity()), ecs::entity::index(entities[1]));
+}
+
+TEST_F(RegistryTest, Snapshot_KeepsLiveUnsavedComponentsAndGroups) {
+    registry.group<Position, Velocity>();
+    Entity kept = registry.spawn_entity();
+    registry.add_component(kept, Position{1.0f, 1.0f});
+    registry.add_component(kept, Velocity{1.0f, 0.0f});
+    registry.add_component(kept, Name{"kept"});
+    std::vector<uint8_t> blob = registry.save_snapshot();
+
+    Entity spawned = registry.spawn_entity();
+    registry.add_component(spawned, Position{2.0f, 2.0f});
+    registry.add_component(spawned, Velocity{1.0f, 0.0f});
+    registry.add_component(spawned, Name{"spawned"});
+    registry.load_snapshot(blob);
+
+    // Name ne participe pas : conservé pour les entités vivantes, retiré des autres
+    EXPECT_EQ(registry.get_components<Name>().size(), 1u);
+    EXPECT_EQ(registry.get_components<Name>()[kept].name, "kept");
+    EXPECT_EQ((registry.group<Position, Velocity>().size()), 1u);
+    EXPECT_TRUE((registry.group<Position, Velocity>().contains(kept)));
+}
+
+TEST_F(RegistryTest, Snapshot_InvalidBlobLeavesRegistryUntouched) {
+    Entity e = registry.spawn_entity();
+    registry.add_component(e, Position{5.0f, 5.0f});
+    std::vector<uint8_t> blob = registry.save_snapshot();
+    blob.resize(blob.size() - 4);
+
+    EXPECT_THROW(registry.load_snapshot(blob), std::runtime_error);
+    EXPECT_THROW(registry.load_snapshot(std::vector<uint8_t>{1, 2, 3}), std::runtime_error);
+    EXPECT_TRUE(registry.is_alive(e));
+    EXPECT_EQ(registry.get_components<Position>()[e].x, 5.0f);
+}
+
+TEST_F(RegistryTest, Snapshot_CorruptedEntitiesAreRejected) {
+    Entity a = registry.spawn_entity();
+    Entity b = registry.spawn_entity();
+    registry.add_component(a, Position{5.0f, 5.0f});
+    registry.kill_entity(b);
+    const std::vector<uint8_t> blob = registry.save_snapshot();
+    // En-tête, 2 générations, 1 slot libre, puis clé, stride et taille du pool Position
+    const size_t free_offset = 8 + 8 + 2 * sizeof(uint32_t) + 8;
+    const size_t entity_offset = free_offset + sizeof(uint32_t) + 4 + 4 + 4 + 8;
+    auto patched = [&blob](size_t offset, auto value) {
+        std::vector<uint8_t> copy = blob;
+        std::memcpy(copy.data() + offset, &value, sizeof(value));
+        return copy;
+    };
+
+    // Slot hors table, slot libéré, génération périmée, slot libre hors table
+    EXPECT_THROW(registry.load_snapshot(patched(entity_offset, ecs::entity::make(7, 0))), std::runtime_error);
+    EXPECT_THROW(registry.load_snapshot(patched(entity_offset, ecs::entity::make(ecs::entity::index(b), 1))),
+        std::runtime_error);
+    EXPECT_THROW(registry.load_snapshot(patched(entity_offset, ecs::entity::make(ecs::entity::index(a), 3))),
+        std::runtime_error);
+    EXPECT_THROW(registry.load_snapshot(patched(free_offset, uint32_t{9})), std::runtime_error);
+    EXPECT_TRUE(registry.is_alive(a));
+    EXPECT_EQ(registry.get_components<Position>()[a].x, 5.0f);
+    EXPECT_NO_THROW(registry.load_snapshot(blob));
+}
+
+// -----------------------------------------------
+// TEST SUITE 15: System Table
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Systems_LookupRemoveAndDisable) {
+    registry.register_system<SpawnerSystem>();
+    registry.register_system<HealthCounterSystem>();
+
+    HealthCounterSystem* counter = registry.find_system<HealthCounterSystem>();
+    ASSERT_NE(counter, nullptr);
+    EXPECT_EQ(&registry.get_system<HealthCounterSystem>(), counter);
+
+    registry.set_system_enabled<SpawnerSystem>(false);
+    EXPECT_FALSE(registry.is_system_enabled<SpawnerSystem>());
+    registry.run_systems(0.016f);
+    EXPECT_EQ(counter->seen, 0u);
+
+    registry.set_system_enabled<SpawnerSystem>(true);
+    registry.run_systems(0.016f);
+    EXPECT_EQ(counter->seen, 1u);
+
+    registry.remove_system<SpawnerSystem>();
+    EXPECT_FALSE(registry.has_system<SpawnerSystem>());
+    EXPECT_EQ(registry.find_system<SpawnerSystem>(), nullptr);
+    EXPECT_THROW(registry.get_system<SpawnerSystem>(), std::runtime_error);
+    registry.run_systems(0.016f);
+    EXPECT_EQ(counter->seen, 1u);
+    // Le pointeur reste valide après le retrait d'un autre système
+    EXPECT_EQ(registry.find_system<HealthCounterSystem>(), counter);
+}
+
+TEST_F(RegistryTest, Systems_DisabledSkippedInParallelMode) {
+    registry.register_system<SpawnerSystem>();
+    registry.register_system<HealthCounterSystem>();
+    registry.set_execution_mode(ecs::ExecutionMode::Parallel, 2);
+
+    registry.set_all_systems_enabled(false);
+    registry.set_system_enabled<HealthCounterSystem>(true);
+    registry.run_systems(0.016f);
+    registry.run_systems(0.016f);
+    EXPECT_EQ(registry.get_system<HealthCounterSystem>().seen, 0u);
+
+    registry.set_all_systems_enabled(true);
+    registry.run_systems(0.016f);
+    EXPECT_EQ(registry.get_system<HealthCounterSystem>().seen, 1u);
+}
+
+TEST_F(RegistryTest, Systems_ProfileRecordsEachRun) {
+    registry.register_system<SpawnerSystem>();
+    registry.register_system<HealthCounterSystem>();
+    registry.set_system_enabled<SpawnerSystem>(false);
+
+    for (int i = 0; i < 10; i++)
+        registry.run_systems(0.016f);
+
+    std::vector<ecs::SystemProfile> profile = registry.system_profile();
+    ASSERT_EQ(profile.size(), 2u);
+    EXPECT_NE(profile[0].name.find("SpawnerSystem"), std::string::npos);
+    EXPECT_FALSE(profile[0].enabled);
+    EXPECT_EQ(profile[0].samples, 0u);
+    EXPECT_NE(profile[1].name.find("HealthCounterSystem"), std::string::npos);
+    EXPECT_EQ(profile[1].samples, 10u);
+    EXPECT_LE(profile[1].p50_us, profile[1].p99_us);
+    EXPECT_LE(profile[1].p99_us, profile[1].max_us);
+
+    registry.reset_system_profile();
+    EXPECT_EQ(registry.system_profile()[1].samples, 0u);
+}
+
+TEST_F(RegistryTest, Systems_HistogramPercentiles) {
+    ecs::TickHistogram histogram;
+
+    for (uint64_t ns = 1; ns <= 1000; ns++)
+        histogram.record(ns * 1000);
+    // Erreur relative bornée par la largeur d'un seau (25 %)
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(0.50)), 500000.0, 125000.0);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(0.99)), 990000.0, 250000.0);
+    EXPECT_EQ(histogram.max_ns(), 1000000u);
+    EXPECT_EQ(histogram.samples(), 1000u);
+}
+
+// -----------------------------------------------
+// TEST SUITE 16: Archetype Backend
+// -----------------------------------------------
+
+// Entités (triées) visitées par view<Position, Velocity>(exclude<Health>)
+static std::vector<Entity> collect_moving(Registry& registry)
+{
+    std::vector<Entity> visited;
+
+    registry.view<Position, Velocity>(ecs::exclude<Health>).each([&](Entity e, Position& pos, Velocity& vel) {
+        EXPECT_EQ(pos.x, vel.x);
+        visited.push_back(e);
+    });
+    std::sort(visited.begin(), visited.end());
+    return visited;
+}
+
+TEST_F(RegistryTest, Archetype_ViewsMatchSparseBackend) {
+    Registry sparse;
+    sparse.register_component<Position>();
+    sparse.register_component<Velocity>();
+    sparse.register_component<Health>();
+    registry.set_storage_backend(ecs::StorageBackend::Archetype);
+    ASSERT_EQ(registry.get_storage_backend(), ecs::StorageBackend::Archetype);
+
+    std::vector<Entity> entities;
+    uint32_t seed = 12345;
+    auto next = [&seed]() { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+
+    for (int step = 0; step < 2000; step++) {
+        uint32_t op = next() % 6;
+        if (op == 0 || entities.empty()) {
+            Entity e = registry.spawn_entity();
+            ASSERT_EQ(sparse.spawn_entity(), e);
+            entities.push_back(e);
+            continue;
+        }
+        size_t pick = next() % entities.size();
+        Entity e = entities[pick];
+        float value = static_cast<float>(step);
+        switch (op) {
+            case 1:
+                registry.add_component<Position>(e, Position{value, 0.0f});
+                sparse.add_component<Position>(e, Position{value, 0.0f});
+                registry.add_component<Velocity>(e, Velocity{value, 0.0f});
+                sparse.add_component<Velocity>(e, Velocity{value, 0.0f});
+                break;
+            case 2:
+                registry.add_component<Health>(e, Health{1});
+                sparse.add_component<Health>(e, Health{1});
+                break;
+            case 3:
+                registry.remove_component<Health>(e);
+                sparse.remove_component<Health>(e);
+                break;
+            case 4:
+                registry.remove_component<Velocity>(e);
+                sparse.remove_component<Velocity>(e);
+                break;
+            default:
+                registry.kill_entity(e);
+                sparse.kill_entity(e);
+                entities[pick] = entities.back();
+                entities.pop_back();
+                break;
+        }
+        if (step % 50 == 0) {
+            ASSERT_EQ(collect_moving(registry), collect_moving(sparse));
+        }
+    }
+    EXPECT_EQ(collect_moving(registry), collect_moving(sparse));
+    EXPECT_GT(registry.archetypes()->archetype_count(), 1u);
+}
+
+TEST_F(RegistryTest, Archetype_ChangesDuringEachVisitOnce) {
+    registry.set_storage_backend(ecs::StorageBackend::Archetype);
+    for (int i = 0; i < 30; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+        registry.add_component<Velocity>(e, Velocity{static_cast<float>(i), 0.0f});
+        if (i % 3 == 0)
+            registry.add_component<Health>(e, Health{i});
+    }
+
+    // Chaque entité visitée change d'archétype (ajout, retrait ou destruction)
+    std::vector<Entity> visited;
+    registry.view<Position, Velocity>().each([&](Entity e, Position& pos, Velocity& vel) {
+        EXPECT_EQ(pos.x, vel.x);
+        visited.push_back(e);
+        int i = static_cast<int>(pos.x);
+        if (i % 3 == 0)
+            registry.remove_component<Health>(e);
+        else if (i % 3 == 1)
+            registry.add_component<Health>(e, Health{i});
+        else
+            registry.kill_entity(e);
+    });
+
+    std::sort(visited.begin(), visited.end());
+    EXPECT_EQ(visited.size(), 30u);
+    EXPECT_EQ(std::unique(visited.begin(), visited.end()), visited.end());
+    EXPECT_EQ((registry.view<Position, Velocity>(ecs::exclude<Health>).size_hint()), 20u);
+    EXPECT_EQ(collect_moving(registry).size(), 10u);
+}
+
+TEST_F(RegistryTest, Archetype_GroupStaysAligned) {
+    registry.set_storage_backend(ecs::StorageBackend::Archetype);
+    std::vector<Entity> entities;
+    for (int i = 0; i < 20; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0)
+            registry.add_component<Velocity>(e, Velocity{static_cast<float>(i), 0.0f});
+        if (i % 4 == 0)
+            registry.add_component<Health>(e, Health{i});
+        entities.push_back(e);
+    }
+    registry.group<Position, Velocity>();
+    expect_group_aligned(registry, 10);
+
+    // Les vues réordonnent les pools possédés : le groupe doit rester en tête
+    EXPECT_EQ(collect_moving(registry).size(), 5u);
+    expect_group_aligned(registry, 10);
+    registry.remove_component<Velocity>(entities[0]);
+    registry.add_component<Velocity>(entities[1], Velocity{1.0f, 0.0f});
+    registry.kill_entity(entities[2]);
+    EXPECT_EQ(collect_moving(registry).size(), 5u);
+    expect_group_aligned(registry, 9);
+
+    registry.set_storage_backend(ecs::StorageBackend::SparseSet);
+    EXPECT_EQ(registry.archetypes(), nullptr);
+    EXPECT_EQ(collect_moving(registry).size(), 5u);
+}
+
+TEST_F(RegistryTest, Archetype_SortedPoolKeepsItsOrder) {
+    registry.set_storage_backend(ecs::StorageBackend::Archetype);
+    for (int i = 0; i < 10; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Health>(e, Health{(i * 7) % 10});
+        registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0)
+            registry.add_component<Velocity>(e, Velocity{0.0f, 0.0f});
+    }
+    registry.sort<Health>([](const Health& a, const Health& b) { return a.hp < b.hp; });
+
+    // La vue compacte les autres pools mais ne touche plus à l'ordre de Health
+    int visited = 0;
+    registry.view<Health, Position>().each([&](Health&, Position&) { visited++; });
+    EXPECT_EQ(visited, 10);
+    auto& health = registry.get_components<Health>();
+    for (size_t i = 0; i < health.size(); i++)
+        EXPECT_EQ(health.get_data_at(i).hp, static_cast<int>(i));
+
+    registry.group<Position, Velocity>();
+    EXPECT_THROW(registry.sort<Position>([](const Position& a, const Position& b) { return a.x < b.x; }),
+        std::logic_error);
+}
+
+// -----------------------------------------------
+// TEST SUITE 17: Prefabs
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Prefab_InstantiateCopiesTemplateThenInitializes) {
+    ecs::Prefab bullet;
+    bullet.with(Position{0.0f, 0.0f}).with(Velocity{1.0f, 0.0f}).with(Health{5});
+    bullet.with(Health{7});
+    ASSERT_EQ(bullet.size(), 3u);
+
+    std::vector<Entity> spawned;
+    registry.instantiate<Position>(bullet, 64, [&](size_t i, Entity e, Position& pos) {
+        pos.x = static_cast<float>(i);
+        spawned.push_back(e);
+    });
+
+    ASSERT_EQ(spawned.size(), 64u);
+    EXPECT_EQ(registry.get_components<Position>().size(), 64u);
+    for (size_t i = 0; i < spawned.size(); i++) {
+        EXPECT_EQ(registry.get_components<Position>()[spawned[i]].x, static_cast<float>(i));
+        EXPECT_EQ(registry.get_components<Velocity>()[spawned[i]].x, 1.0f);
+        EXPECT_EQ(registry.get_components<Health>()[spawned[i]].hp, 7);
+    }
+    EXPECT_EQ((registry.view<Position, Velocity, Health>().size_hint()), 64u);
+
+    Entity single = registry.instantiate(bullet);
+    EXPECT_TRUE(registry.get_components<Velocity>().has_entity(single));
+    EXPECT_THROW((registry.instantiate<Name>(bullet, 1, [](size_t, Entity, Name&) {})), std::logic_error);
+}
+
+TEST_F(RegistryTest, Prefab_RecordedDuringViewAreStampedAtFlush) {
+    ecs::Prefab bullet;
+    bullet.with(Position{0.0f, 0.0f}).with(Velocity{0.0f, 0.0f});
+    registry.group<Position, Velocity>();
+    for (int i = 0; i < 4; i++) {
+        Entity e = registry.spawn_entity();
+        registry.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+        registry.add_component<Velocity>(e, Velocity{static_cast<float>(i), 0.0f});
+        registry.add_component<Health>(e, Health{i});
+    }
+
+    // Chaque tireur enregistre une salve de 8 projectiles
+    registry.view<Position, Health>().each([&](Position& pos, Health&) {
+        float x = pos.x;
+        registry.commands().instantiate<Position, Velocity>(bullet, 8, [x](size_t i, Entity, Position& shot, Velocity& vel) {
+            shot = Position{x, 0.0f};
+            vel = Velocity{x, static_cast<float>(i)};
+        });
+    });
+    EXPECT_EQ(registry.get_components<Velocity>().size(), 4u);
+
+    registry.flush_commands();
+    expect_group_aligned(registry, 36);
+    int shots = 0;
+    registry.view<Velocity>(ecs::exclude<Health>).each([&](Velocity& vel) {
+        EXPECT_LT(vel.y, 8.0f);
+        shots++;
+    });
+    EXPECT_EQ(shots, 32);
+}
+
+// -----------------------------------------------
+// TEST SUITE 18: Memory resource
+// -----------------------------------------------
+
+// Compte les octets alloués et encore vivants, délègue au tas
+class CountingResource : public std::pmr::memory_resource {
+    public:
+        size_t allocated = 0;
+        size_t live = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            allocated += bytes;
+            live += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            live -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+};
+
+TEST_F(RegistryTest, Arena_PoolsAllocateFromTheResource) {
+    CountingResource arena;
+    {
+        Registry session(&arena);
+        EXPECT_EQ(session.memory_resource(), &arena);
+        session.register_component<Position>();
+        session.register_component<Velocity>();
+        session.group<Position, Velocity>();
+
+        std::vector<Entity> entities;
+        for (int i = 0; i < 2000; i++) {
+            Entity e = session.spawn_entity();
+            session.add_component<Position>(e, Position{static_cast<float>(i), 0.0f});
+            if (i % 2 == 0)
+                session.add_component<Velocity>(e, Velocity{static_cast<float>(i), 0.0f});
+            entities.push_back(e);
+        }
+        // Dense, données, ticks et pages sparse des deux pools
+        size_t minimum = 2000 * (sizeof(Entity) + sizeof(Position) + sizeof(uint32_t))
+            + 1000 * (sizeof(Entity) + sizeof(Velocity) + sizeof(uint32_t));
+        EXPECT_GE(arena.live, minimum);
+        expect_group_aligned(session, 1000);
+
+        for (size_t i = 0; i < entities.size(); i += 3)
+            session.kill_entity(entities[i]);
+        EXPECT_EQ(session.get_components<Position>().size(), 1333u);
+        EXPECT_GT(arena.live, 0u);
+    }
+    // Plus rien ne reste dans la ressource une fois le Registry détruit
+    EXPECT_GT(arena.allocated, 0u);
+    EXPECT_EQ(arena.live, 0u);
+}
+
+// -----------------------------------------------
+// TEST SUITE 19: Signals and observers
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Signals_EmittedOnStructuralChangesOnly) {
+    std::vector<Entity> constructed;
+    std::vector<Entity> destroyed;
+    size_t id = registry.on_construct<Health>().connect([&](Entity e) { constructed.push_back(e); });
+    registry.on_destroy<Health>().connect([&](Entity e) {
+        // Le composant est encore lisible avant son retrait
+        EXPECT_TRUE(registry.get_components<Health>().has_entity(e));
+        destroyed.push_back(e);
+    });
+
+    Entity a = registry.spawn_entity();
+    Entity b = registry.spawn_entity();
+    registry.add_component<Health>(a, Health{1});
+    registry.add_component<Health>(a, Health{2});
+    registry.emplace_component<Health>(b, 3);
+    registry.add_component<Position>(b, Position{0.0f, 0.0f});
+    EXPECT_EQ(constructed, (std::vector<Entity>{a, b}));
+
+    registry.remove_component<Health>(a);
+    registry.remove_component<Health>(a);
+    registry.kill_entity(b);
+    EXPECT_EQ(destroyed, (std::vector<Entity>{a, b}));
+
+    registry.on_construct<Health>().disconnect(id);
+    registry.add_component<Health>(registry.spawn_entity(), Health{4});
+    EXPECT_EQ(constructed.size(), 2u);
+    // Réenregistrer le composant vide son pool : un on_destroy par entité
+    registry.register_component<Health>();
+    EXPECT_EQ(destroyed.size(), 3u);
+}
+
+TEST_F(RegistryTest, Observer_FollowsIncludeAndExcludeChanges) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 6; i++) {
+        entities.push_back(registry.spawn_entity());
+        registry.add_component<Position>(entities.back(), Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0)
+            registry.add_component<Health>(entities.back(), Health{i});
+    }
+    ecs::Observer& observer = registry.observer<Position, Health>(ecs::exclude<Velocity>);
+    EXPECT_EQ(&observer, &(registry.observer<Position, Health>(ecs::exclude<Velocity>)));
+    EXPECT_EQ(observer.size(), 3u);
+
+    auto expect_matches_view = [&]() {
+        std::vector<Entity> viewed;
+        registry.view<Position, Health>(ecs::exclude<Velocity>).each([&](Entity e, Position&, Health&) {
+            viewed.push_back(e);
+        });
+        std::vector<Entity> observed(observer.entities().begin(), observer.entities().end());
+        std::sort(viewed.begin(), viewed.end());
+        std::sort(observed.begin(), observed.end());
+        EXPECT_EQ(observed, viewed);
+    };
+
+    registry.add_component<Health>(entities[1], Health{1});
+    registry.add_component<Velocity>(entities[2], Velocity{0.0f, 0.0f});
+    registry.remove_component<Position>(entities[4]);
+    EXPECT_EQ(observer.size(), 2u);
+    expect_matches_view();
+
+    registry.remove_component<Velocity>(entities[2]);
+    registry.add_component<Position>(entities[4], Position{4.0f, 0.0f});
+    EXPECT_TRUE(observer.contains(entities[2]));
+    expect_matches_view();
+
+    // Mort de l'entité pendant le parcours, y compris avec le composant exclu
+    registry.add_component<Velocity>(entities[0], Velocity{0.0f, 0.0f});
+    observer.each([&](Entity e) { registry.kill_entity(e); });
+    EXPECT_EQ(observer.size(), 0u);
+    registry.kill_entity(entities[0]);
+    EXPECT_FALSE(observer.contains(entities[0]));
+    expect_matches_view();
+}
+
+// -----------------------------------------------
+// TEST SUITE 20: Parent/child links
+// -----------------------------------------------
+
+TEST_F(RegistryTest, Hierarchy_TraversalVisitsParentsFirst) {
+    Entity player = registry.spawn_entity();
+    Entity companion = registry.spawn_entity();
+    Entity flash = registry.spawn_entity();
+    Entity shield = registry.spawn_entity();
+
+    // Lié avant son parent : l'ordre de création ne compte pas
+    registry.set_parent(flash, companion);
+    registry.set_parent(companion, player);
+    registry.set_parent(shield, player);
+    EXPECT_EQ(registry.parent_of(flash), companion);
+    EXPECT_EQ(registry.hierarchy().root_count(), 1u);
+    EXPECT_THROW(registry.set_parent(player, flash), std::logic_error);
+
+    std::vector<Entity> children;
+    registry.each_child(player, [&](Entity child) { children.push_back(child); });
+    EXPECT_EQ(children, (std::vector<Entity>{companion, shield}));
+
+    std::vector<std::pair<Entity, Entity>> links;
+    registry.each_link([&](Entity parent, Entity child) { links.emplace_back(parent, child); });
+    EXPECT_EQ(links, (std::vector<std::pair<Entity, Entity>>{
+        {player, companion}, {companion, flash}, {player, shield}}));
+
+    // Tuer le parent détache ses enfants, le compagnon devient une racine
+    registry.kill_entity(player);
+    EXPECT_EQ(registry.parent_of(companion), ecs::Hierarchy::NONE);
+    EXPECT_EQ(registry.parent_of(flash), companion);
+    EXPECT_EQ(registry.hierarchy().root_count(), 1u);
+    Entity recycled = registry.spawn_entity();
+    EXPECT_EQ(registry.hierarchy().child_count(recycled), 0u);
+}
+
+TEST_F(RegistryTest, Hierarchy_DeadHandlesAreNotLinked) {
+    Entity p = registry.spawn_entity();
+    Entity kid = registry.spawn_entity();
+    Entity c = registry.spawn_entity();
+    registry.kill_entity(c);
+    Entity d = registry.spawn_entity();
+    ASSERT_EQ(ecs::entity::index(c), ecs::entity::index(d));
+
+    registry.set_parent(kid, d);
+    registry.set_parent(c, p);
+    registry.set_parent(kid, c);
+
+    EXPECT_EQ(registry.parent_of(kid), d);
+    EXPECT_EQ(registry.hierarchy().child_count(d), 1u);
+    EXPECT_EQ(registry.parent_of(c), ecs::Hierarchy::NONE);
+    EXPECT_EQ(registry.hierarchy().child_count(p), 0u);
+    size_t links = 0;
+    registry.each_link([&](Entity, Entity) { links++; });
+    EXPECT_EQ(links, 1u);
+}
+
+TEST_F(RegistryTest, Hierarchy_KillHierarchyCascades) {
+    Entity root = registry.spawn_entity();
+    Entity other = registry.spawn_entity();
+    std::vector<Entity> subtree;
+    for (int i = 0; i < 3; i++) {
+        subtree.push_back(registry.spawn_entity());
+        registry.add_component<Position>(subtree.back(), Position{0.0f, 0.0f});
+        registry.set_parent(subtree.back(), i == 2 ? subtree[0] : root);
+    }
+    registry.set_parent(subtree[1], other);
+    EXPECT_EQ(registry.hierarchy().child_count(root), 1u);
+
+    registry.kill_hierarchy(root);
+    EXPECT_FALSE(registry.is_alive(root));
+    EXPECT_FALSE(registry.is_alive(subtree[0]));
+    EXPECT_FALSE(registry.is_alive(subtree[2]));
+    EXPECT_TRUE(registry.is_alive(subtree[1]));
+    EXPECT_EQ(registry.get_components<Position>().size(), 1u);
+    EXPECT_EQ(registry.parent_of(subtree[1]), other);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -7,7 +7,10 @@
 
 #include <gtest/gtest.h>
 #include "ecs/SparseSet.hpp"
+#include <algorithm>
+#include <memory_resource>
 #include <string>
+#include <vector>
 
 // Test structures
 struct TestData {
@@ -25,6 +28,22 @@ struct ComplexData {
     }
 };
 
+// Empty component (tag): no per-entity storage
+struct TagData {};
+
+// Counts copies to check that insert/erase only move components around
+struct CopyCounter {
+    static inline int copies = 0;
+    std::vector<int> payload;
+
+    CopyCounter() = default;
+    explicit CopyCounter(size_t size) : payload(size, 1) {}
+    CopyCounter(const CopyCounter& other) : payload(other.payload) { copies++; }
+    CopyCounter(CopyCounter&&) noexcept = default;
+    CopyCounter& operator=(const CopyCounter& other) { payload = other.payload; copies++; return *this; }
+    CopyCounter& operator=(CopyCounter&&) noexcept = default;
+};
+
 // ============================================================================
 // SPARSESET TESTS
 // ============================================================================
@@ -409,6 +428,208 @@ TEST_F(SparseSetTest, Integration_FragmentedMemory) {
     EXPECT_EQ(intSet[10000], 50);
 }
 
+// -----------------------------------------------
+// TEST SUITE 9: Paged Sparse Index
+// -----------------------------------------------
+
+TEST_F(SparseSetTest, Paging_HighIdAllocatesSinglePage) {
+    intSet.insert_at(1000000, 7);
+
+    EXPECT_EQ(intSet[1000000], 7);
+    EXPECT_FALSE(intSet.has_entity(999999));
+    EXPECT_FALSE(intSet.has_entity(0));
+    // Only the page covering slot 1000000 holds dense indices
+    EXPECT_LT(intSet.sparse_memory_usage(),
+        (1000000 / SparseSet<int>::PAGE_SIZE + 1) * sizeof(std::pmr::vector<uint32_t>)
+        + 2 * SparseSet<int>::PAGE_SIZE * sizeof(uint32_t));
+}
+
+TEST_F(SparseSetTest, Paging_EntitiesAcrossPageBoundary) {
+    const size_t boundary = SparseSet<int>::PAGE_SIZE;
+
+    intSet.insert_at(boundary - 1, 1);
+    intSet.insert_at(boundary, 2);
+    intSet.erase(boundary - 1);
+
+    EXPECT_FALSE(intSet.has_entity(boundary - 1));
+    EXPECT_EQ(intSet[boundary], 2);
+    EXPECT_EQ(intSet.size(), 1u);
+}
+
+TEST_F(SparseSetTest, Paging_UntouchedPageIsNotAllocated) {
+    EXPECT_EQ(intSet.sparse_memory_usage(), 0u);
+    EXPECT_FALSE(intSet.has_entity(5000));
+    EXPECT_THROW(intSet[5000], std::bad_optional_access);
+    EXPECT_EQ(intSet.sparse_memory_usage(), 0u);
+}
+
+// -----------------------------------------------
+// TEST SUITE 10: Move Semantics
+// -----------------------------------------------
+
+TEST_F(SparseSetTest, Move_InsertRvalueAndEmplaceDoNotCopy) {
+    SparseSet<CopyCounter> set;
+    CopyCounter::copies = 0;
+
+    for (size_t i = 0; i < 100; i++)
+        set.insert_at(i, CopyCounter(8));
+    for (size_t i = 100; i < 200; i++)
+        set.emplace(i, 8u);
+    set.insert_at(5, CopyCounter(3));
+
+    EXPECT_EQ(CopyCounter::copies, 0);
+    EXPECT_EQ(set.size(), 200u);
+    EXPECT_EQ(set[5].payload.size(), 3u);
+    EXPECT_EQ(set[150].payload.size(), 8u);
+}
+
+TEST_F(SparseSetTest, Move_SwapRemoveDoesNotCopy) {
+    SparseSet<CopyCounter> set;
+    for (size_t i = 0; i < 10; i++)
+        set.emplace(i, i + 1);
+    CopyCounter::copies = 0;
+
+    set.erase(0);
+    set.erase(9);
+    set.erase(4);
+
+    EXPECT_EQ(CopyCounter::copies, 0);
+    EXPECT_EQ(set.size(), 7u);
+    // L'élément déplacé garde ses données
+    EXPECT_EQ(set[8].payload.size(), 9u);
+}
+
+TEST_F(SparseSetTest, Move_EmplaceAggregate) {
+    ComplexData& data = complexSet.emplace(3, 1, 2, 3, std::string("aggregate"));
+
+    EXPECT_EQ(data.name, "aggregate");
+    EXPECT_EQ(complexSet[3], (ComplexData{1, 2, 3, "aggregate"}));
+}
+
+// -----------------------------------------------
+// TEST SUITE 11: Change Ticks
+// -----------------------------------------------
+
+TEST_F(SparseSetTest, Changes_PatchAndInsertAreStamped) {
+    uint32_t clock = 1;
+    dataSet.set_clock(&clock);
+    for (size_t i = 0; i < 5; i++)
+        dataSet.insert_at(i, TestData{static_cast<int>(i)});
+
+    clock = 2;
+    dataSet.patch(3, [](TestData& data) { data.value = 30; });
+    dataSet[1].value = 10;  // Accès mutable simple : non marqué
+    dataSet.touch(4);
+    dataSet.insert_at(7, TestData{7});
+
+    std::vector<size_t> changed;
+    dataSet.changed_since(1, [&](Entity e, TestData&) { changed.push_back(e); });
+    std::sort(changed.begin(), changed.end());
+
+    EXPECT_EQ(changed, (std::vector<size_t>{3, 4, 7}));
+    EXPECT_EQ(dataSet[3].value, 30);
+    EXPECT_EQ(dataSet.changed_tick(0), 1u);
+    EXPECT_EQ(dataSet.changed_tick(42), 0u);
+    EXPECT_THROW(dataSet.patch(42, [](TestData&) {}), std::bad_optional_access);
+}
+
+TEST_F(SparseSetTest, Changes_TicksFollowSwapRemove) {
+    uint32_t clock = 1;
+    dataSet.set_clock(&clock);
+    for (size_t i = 0; i < 4; i++) {
+        clock = static_cast<uint32_t>(i + 1);
+        dataSet.insert_at(i, TestData{static_cast<int>(i)});
+    }
+
+    dataSet.erase(0);  // 3 prend la place de 0
+    dataSet.swap_at(0, 1);
+
+    for (size_t i = 1; i < 4; i++)
+        EXPECT_EQ(dataSet.changed_tick(i), i + 1);
+}
+
+// -----------------------------------------------
+// TEST SUITE 12: Tag Components
+// -----------------------------------------------
+
+TEST_F(SparseSetTest, Tag_MembershipWithoutStorage) {
+    SparseSet<TagData> tags;
+    for (size_t i = 0; i < 10; i++)
+        tags.insert_at(i, TagData{});
+    tags.emplace(3);
+
+    tags.erase(0);
+    tags.erase(7);
+
+    EXPECT_EQ(tags.size(), 8u);
+    EXPECT_FALSE(tags.has_entity(0));
+    EXPECT_FALSE(tags.has_entity(7));
+    EXPECT_TRUE(tags.has_entity(9));
+    EXPECT_NE(tags.find(9), nullptr);
+    EXPECT_EQ(tags.find(7), nullptr);
+    EXPECT_EQ(tags.raw(), nullptr);
+    EXPECT_THROW(tags[7], std::bad_optional_access);
+}
+
+TEST_F(SparseSetTest, Tag_SwapKeepsIndexConsistent) {
+    SparseSet<TagData> tags;
+    for (size_t i = 0; i < 4; i++)
+        tags.insert_at(i, TagData{});
+
+    tags.swap_at(0, 3);
+    EXPECT_EQ(tags.get_entity_at(0), 3u);
+    EXPECT_EQ(tags.index_of(3), 0u);
+    EXPECT_EQ(tags.index_of(0), 3u);
+}
+
+// -----------------------------------------------
+// TEST SUITE 13: Sorting
+// -----------------------------------------------
+
+static void expect_sorted_and_indexed(SparseSet<int>& set)
+{
+    for (size_t i = 0; i < set.size(); i++) {
+        EXPECT_EQ(set.index_of(set.get_entity_at(i)), i);
+        // Valeur = 10 * entité dans ces tests : données et entités restent liées
+        EXPECT_EQ(set.get_data_at(i), static_cast<int>(set.get_entity_at(i)) * 10);
+        if (i > 0) {
+            EXPECT_LE(set.get_data_at(i - 1), set.get_data_at(i));
+        }
+    }
+}
+
+TEST_F(SparseSetTest, Sort_FullSortKeepsSparseIndex) {
+    for (Entity e : {7u, 2u, 9u, 4u, 0u, 5u})
+        intSet.insert_at(e, static_cast<int>(e) * 10);
+
+    intSet.sort([](int a, int b) { return a < b; });
+    expect_sorted_and_indexed(intSet);
+    EXPECT_EQ(intSet.get_entity_at(0), 0u);
+    EXPECT_EQ(intSet.get_entity_at(5), 9u);
+}
+
+TEST_F(SparseSetTest, Sort_IncrementalRepairsNearlySortedSet) {
+    for (Entity e = 0; e < 100; e++)
+        intSet.insert_at(e, static_cast<int>(e) * 10);
+
+    // Quelques retraits (échange avec le dernier) et ajouts en fin de tableau
+    intSet.erase(10);
+    intSet.erase(50);
+    intSet.insert_at(3, 30);
+    intSet.insert_at(150, 1500);
+    intSet.insert_at(10, 100);
+    intSet.sort_incremental([](int a, int b) { return a < b; });
+    expect_sorted_and_indexed(intSet);
+    EXPECT_EQ(intSet.size(), 100u);
+
+    // Ordre inverse : dépasse le budget de l'insertion, termine par un tri complet
+    SparseSet<int> reversed;
+    for (Entity e = 0; e < 500; e++)
+        reversed.insert_at(499 - e, static_cast<int>(499 - e) * 10);
+    reversed.sort_incremental([](int a, int b) { return a < b; });
+    expect_sorted_and_indexed(reversed);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
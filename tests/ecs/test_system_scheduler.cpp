@@ -0,0 +1,270 @@
+/*
+** EPITECH PROJECT, 2025
+** Mirror-R-Type
+** File description:
+** test_system_scheduler
+*/
+
+#include <gtest/gtest.h>
+#include "ecs/Registry.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Test Components
+struct Position {
+    float x, y;
+};
+
+struct Velocity {
+    float x, y;
+};
+
+struct Health {
+    int hp;
+};
+
+struct Lifetime {
+    float remaining;
+};
+
+struct Counter {
+    int value;
+};
+
+// ============================================================================
+// TEST SYSTEMS
+// ============================================================================
+
+// Integrates Position from Velocity
+class MoveSystem : public ISystem {
+    public:
+        void init(Registry&) override {}
+        void shutdown() override {}
+        void declare_access(ecs::SystemAccess& access) const override
+        {
+            access.reads<Velocity>().writes<Position>();
+        }
+        void update(Registry& registry, float dt) override
+        {
+            registry.view<Position, Velocity>().each([dt](Position& pos, Velocity& vel) {
+                pos.x += vel.x * dt;
+                pos.y += vel.y * dt;
+            });
+        }
+};
+
+// Independent of MoveSystem: may share its stage
+class RegenSystem : public ISystem {
+    public:
+        void init(Registry&) override {}
+        void shutdown() override {}
+        void declare_access(ecs::SystemAccess& access) const override
+        {
+            access.writes<Health>();
+        }
+        void update(Registry& registry, float) override
+        {
+            registry.view<Health>().each([](Health& health) {
+                health.hp = std::min(health.hp + 1, 100);
+            });
+        }
+};
+
+// Independent of MoveSystem and RegenSystem; kills through commands
+class LifetimeSystem : public ISystem {
+    public:
+        void init(Registry&) override {}
+        void shutdown() override {}
+        void declare_access(ecs::SystemAccess& access) const override
+        {
+            access.writes<Lifetime>();
+        }
+        void update(Registry& registry, float dt) override
+        {
+            registry.view<Lifetime>().each([&registry, dt](Entity e, Lifetime& life) {
+                life.remaining -= dt;
+                if (life.remaining <= 0.0f)
+                    registry.commands().kill(e);
+            });
+        }
+};
+
+// Reads Position written by MoveSystem: must run after it; spawns through commands
+class SpawnerSystem : public ISystem {
+    public:
+        void init(Registry&) override {}
+        void shutdown() override {}
+        void declare_access(ecs::SystemAccess& access) const override
+        {
+            access.reads<Health>().writes<Position, Velocity, Lifetime>();
+        }
+        void update(Registry& registry, float) override
+        {
+            std::vector<Position> spawn_points;
+            registry.view<Position, Health>().each([&](Position& pos, Health& health) {
+                if (health.hp % 10 == 0)
+                    spawn_points.push_back(pos);
+            });
+            for (const Position& pos : spawn_points) {
+                Entity bullet = registry.commands().spawn();
+                registry.commands().add(bullet, Position{pos.x, pos.y});
+                registry.commands().add(bullet, Velocity{-5.0f, 1.0f});
+                registry.commands().add(bullet, Lifetime{0.05f});
+            }
+        }
+};
+
+// Default access: exclusive
+class TallySystem : public ISystem {
+    public:
+        void init(Registry&) override {}
+        void shutdown() override {}
+        void update(Registry& registry, float) override
+        {
+            auto& counters = registry.get_components<Counter>();
+            if (counters.size() > 0)
+                counters.get_data_at(0).value += static_cast<int>(registry.get_components<Position>().size());
+        }
+};
+
+// ============================================================================
+// FIXTURE
+// ============================================================================
+
+class SystemSchedulerTest : public ::testing::Test {
+protected:
+    static void populate(Registry& registry)
+    {
+        registry.register_component<Position>();
+        registry.register_component<Velocity>();
+        registry.register_component<Health>();
+        registry.register_component<Lifetime>();
+        registry.register_component<Counter>();
+
+        for (int i = 0; i < 200; i++) {
+            Entity e = registry.spawn_entity();
+            registry.add_component(e, Position{static_cast<float>(i), 0.0f});
+            registry.add_component(e, Velocity{1.0f, static_cast<float>(i % 7)});
+            if (i % 3 == 0)
+                registry.add_component(e, Health{i % 50});
+        }
+        registry.add_component(registry.spawn_entity(), Counter{0});
+
+        registry.register_system<MoveSystem>();
+        registry.register_system<RegenSystem>();
+        registry.register_system<LifetimeSystem>();
+        registry.register_system<SpawnerSystem>();
+        registry.register_system<TallySystem>();
+    }
+
+    using EntityState = std::tuple<Entity, float, float>;
+
+    static std::vector<EntityState> snapshot(Registry& registry)
+    {
+        std::vector<EntityState> state;
+        registry.view<Position>().each([&](Entity e, Position& pos) {
+            state.emplace_back(e, pos.x, pos.y);
+        });
+        std::sort(state.begin(), state.end());
+        return state;
+    }
+};
+
+// -----------------------------------------------
+// TEST SUITE 1: Stage Building
+// -----------------------------------------------
+
+TEST_F(SystemSchedulerTest, Stages_GroupNonConflictingSystems) {
+    std::vector<ecs::SystemAccess> accesses(5);
+    MoveSystem().declare_access(accesses[0]);
+    RegenSystem().declare_access(accesses[1]);
+    LifetimeSystem().declare_access(accesses[2]);
+    SpawnerSystem().declare_access(accesses[3]);
+    TallySystem().declare_access(accesses[4]);
+
+    ecs::SystemScheduler scheduler(0);
+    scheduler.build(accesses);
+
+    // [Move, Regen, Lifetime] [Spawner] [Tally]
+    ASSERT_EQ(scheduler.stages().size(), 3u);
+    EXPECT_EQ(scheduler.stages()[0], (std::vector<size_t>{0, 1, 2}));
+    EXPECT_EQ(scheduler.stages()[1], (std::vector<size_t>{3}));
+    EXPECT_EQ(scheduler.stages()[2], (std::vector<size_t>{4}));
+}
+
+TEST_F(SystemSchedulerTest, Stages_EmptyAccessNeverConflicts) {
+    ecs::SystemAccess exclusive;
+    ecs::SystemAccess empty;
+    exclusive.exclusive();
+
+    EXPECT_TRUE(exclusive.conflicts_with(exclusive));
+    EXPECT_FALSE(exclusive.conflicts_with(empty));
+    EXPECT_FALSE(empty.conflicts_with(exclusive));
+}
+
+// -----------------------------------------------
+// TEST SUITE 2: Serial / Parallel Equivalence
+// -----------------------------------------------
+
+TEST_F(SystemSchedulerTest, Parallel_MatchesSerialEndOfTickState) {
+    Registry serial;
+    Registry parallel;
+    populate(serial);
+    populate(parallel);
+    parallel.set_execution_mode(ecs::ExecutionMode::Parallel, 4);
+
+    for (int tick = 0; tick < 30; tick++) {
+        serial.run_systems(0.016f);
+        parallel.run_systems(0.016f);
+
+        ASSERT_EQ(snapshot(serial), snapshot(parallel)) << "diverged at tick " << tick;
+        ASSERT_EQ(serial.entity_capacity(), parallel.entity_capacity());
+        ASSERT_EQ(serial.get_components<Counter>().get_data_at(0).value,
+            parallel.get_components<Counter>().get_data_at(0).value);
+    }
+    EXPECT_GT(serial.get_components<Lifetime>().size(), 0u);
+}
+
+TEST_F(SystemSchedulerTest, Parallel_ExceptionIsRethrown) {
+    class ThrowingSystem : public ISystem {
+        public:
+            void init(Registry&) override {}
+            void shutdown() override {}
+            void declare_access(ecs::SystemAccess& access) const override { access.writes<Counter>(); }
+            void update(Registry&, float) override { throw std::runtime_error("boom"); }
+    };
+
+    Registry registry;
+    populate(registry);
+    registry.register_system<ThrowingSystem>();
+    registry.set_execution_mode(ecs::ExecutionMode::Parallel, 4);
+
+    EXPECT_THROW(registry.run_systems(0.016f), std::runtime_error);
+    // Le registre reste utilisable en série
+    registry.set_execution_mode(ecs::ExecutionMode::Serial);
+    EXPECT_THROW(registry.run_systems(0.016f), std::runtime_error);
+}
+
+// -----------------------------------------------
+// TEST SUITE 3: Access Bounds
+// -----------------------------------------------
+
+template <size_t N>
+struct Tag {};
+
+template <size_t... N>
+void declare_tags(ecs::SystemAccess& access, std::index_sequence<N...>)
+{
+    access.reads<Tag<N>...>();
+}
+
+// Dernier test du fichier : il épuise les identifiants de familles de composants
+TEST_F(SystemSchedulerTest, Access_TooManyComponentTypesThrows) {
+    ecs::SystemAccess access;
+
+    EXPECT_THROW(declare_tags(access, std::make_index_sequence<ecs::MAX_COMPONENTS + 1>{}), std::length_error);
+    EXPECT_THROW(access.writes<Tag<ecs::MAX_COMPONENTS + 1>>(), std::length_error);
+}